@@ -8,6 +8,7 @@
 #include "ObjectTools.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
+#include "SuperManager.h"
 
 void UQuickAssetAction::DuplicateAsset(int32 NumOfDuplicates)
 {
@@ -24,15 +25,15 @@ void UQuickAssetAction::DuplicateAsset(int32 NumOfDuplicates)
 	{
 		for (int32 i = 0; i < NumOfDuplicates; i++)
 		{
-			//  
+			// 원본의 경로
 			//const FString SourceAssetPath = SelectedAssetData.ObjectPath.ToString();
 			const FString SourceAssetPath = SelectedAssetData.GetSoftObjectPath().ToString();
 
-			// ǰ "̸ + _Index"  ش.
+			// 복제품의 "이름 + _복제Index" 를 만들어준다.
 			const FString NewDuplicatedAssetName = SelectedAssetData.AssetName.ToString() 
 													+ TEXT("_") + FString::FromInt(i+1);
 			
-			//    .   Ű     ǰ ̸ ޾־ .
+			// 복제한 에셋을 저장할 경로. 선택한 에셋의 패키지 경로 에 새로 만들 복제품의 이름을 달아주어야 함.
 			const FString NewPathName 
 				= FPaths::Combine(SelectedAssetData.PackagePath.ToString(), NewDuplicatedAssetName);
 
@@ -95,15 +96,27 @@ void UQuickAssetAction::RemoveUnusedAssets()
 	TArray<FAssetData> SelectedAssetsData = UEditorUtilityLibrary::GetSelectedAssetData();
 	TArray<FAssetData> UnusedAssetsData;
 
-	// ϱ   ش.
-	FixUpRedirectors();
+	// 삭제하기전에 콘텐츠 브라우저를 갱신해준다.
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
 
+	// Only the folders of the selection are in scope
+	TArray<FString> SelectedFolderPaths;
 	for (const auto& SelectedAssetData : SelectedAssetsData)
 	{
-		TArray<FString> AssetRefrencers = 
-		UEditorAssetLibrary::FindPackageReferencersForAsset(SelectedAssetData.GetSoftObjectPath().ToString());
+		SelectedFolderPaths.AddUnique(SelectedAssetData.PackagePath.ToString());
+	}
+
+	SuperManagerModule.GetRedirectorFixup().FixUpRedirectors(SelectedFolderPaths);
+
+	const FSuperManagerReferenceIndex& ReferenceIndex = SuperManagerModule.GetReferenceIndex();
+	const FSuperManagerPathExclusion& Exclusion = SuperManagerModule.GetPathExclusion();
+
+	for (const auto& SelectedAssetData : SelectedAssetsData)
+	{
+		if (Exclusion.IsPackagePathExcluded(SelectedAssetData.PackagePath)) continue;
 
-		if (AssetRefrencers.Num() == 0)
+		if (ReferenceIndex.IsPackageUnused(SelectedAssetData.PackageName))
 		{
 			UnusedAssetsData.Add(SelectedAssetData);
 		}
@@ -115,38 +128,7 @@ void UQuickAssetAction::RemoveUnusedAssets()
 		return;
 	}
 
-	const int32 NumOfAssetsDeleted = ObjectTools::DeleteAssets(UnusedAssetsData);
+	const int32 NumOfAssetsDeleted = SuperManagerModule.DeleteAssetsWithoutLoading(UnusedAssetsData);
 	if (NumOfAssetsDeleted == 0) return;
 	DebugHeader::ShowNotifyInfo(TEXT("Succecfully deleted " + FString::FromInt(NumOfAssetsDeleted) + TEXT(" UnusedAssets")));
 }
-
-void UQuickAssetAction::FixUpRedirectors()
-{
-	TArray<UObjectRedirector*> RedirectorsToFixArray;
-
-	FAssetRegistryModule& AssetRegistryModule = 
-		FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-
-	FARFilter Filter;
-	Filter.bRecursivePaths = true;
-	Filter.PackagePaths.Emplace("/Game");
-	Filter.ClassNames.Emplace("ObjectRedirector");
-
-	TArray<FAssetData> OutRedirectors;
-	AssetRegistryModule.Get().GetAssets(Filter, OutRedirectors);
-
-	for (const auto& RedirectorData : OutRedirectors)
-	{
-		if (UObjectRedirector* RedirectorToFix = Cast<UObjectRedirector>(RedirectorData.GetAsset()))
-		{
-			RedirectorsToFixArray.Add(RedirectorToFix);
-		}
-	}
-
-	FAssetToolsModule& AssetToolsModule = 
-		FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-
-	AssetToolsModule.Get().FixupReferencers(RedirectorsToFixArray);
-
-}
-
@@ -88,7 +88,7 @@ void UQuickMaterialCreationWidget::CreateMaterialFromSelectedTexture()
 
 #pragma region QuickMaterialCreation
 
-// ؽó ͸ϴ Լ.
+// 텍스처를 필터링하는 함수.
 bool UQuickMaterialCreationWidget::ProcessSelectedData(
 	const TArray<FAssetData>& SelectedDataToProcess,
 	TArray<UTexture2D*>& OutSelectedTexturesArray, 
@@ -122,7 +122,7 @@ bool UQuickMaterialCreationWidget::ProcessSelectedData(
 		if(OutSelectedTexturePackagePath.IsEmpty())
 			OutSelectedTexturePackagePath = SelectedData.PackagePath.ToString();
 
-		// ڰ ؽó ̸  ϱ⸦ .
+		// 사용자가 텍스처 이름을 재질로 사용하기를 원함.
 		if (!bCustomMaterialName && !bMaterialNameSet)
 		{
 			bMaterialNameSet = true;
@@ -137,7 +137,7 @@ bool UQuickMaterialCreationWidget::ProcessSelectedData(
 bool UQuickMaterialCreationWidget::CheckIsNameUsed(
 	const FString& FolderPathToCheck, const FString& MaterialNameToCheck)
 {
-	// Ʒ Լ  ° ڴ   ̳. ο ִ  ˻ ̳ .
+	// 아래 함수 두 번째 인자는 재귀적으로 할 것이냐. 내부에 있는 폴더까지 검사할 것이냐 여부임.
 	TArray<FString> ExistingAssetsPaths = UEditorAssetLibrary::ListAssets(FolderPathToCheck, false);
 
 	for (const auto& ExistingAssetPath : ExistingAssetsPaths)
@@ -174,7 +174,7 @@ void UQuickMaterialCreationWidget::Default_CreateMaterialNodes(
 	
 	if (!TextureSampleNode) return;
 
-	//   
+	// 핀 연결 가능
 	if (!CreatedMaterial->HasBaseColorConnected())
 	{
 		if (TryConnectBaseColor(TextureSampleNode, SelectedTexture, CreatedMaterial))
@@ -224,12 +224,12 @@ void UQuickMaterialCreationWidget::Default_CreateMaterialNodes(
 
 void UQuickMaterialCreationWidget::ORM_CreateMaterialNodes(UMaterial* CreatedMaterial, UTexture2D* SelectedTexture, uint32& PinsConnectedCounter)
 {
-	// ̽ ÷, , ARM  .
+	// 베이스 컬러, 노멀, ARM 만 연결.
 	UMaterialExpressionTextureSample* TextureSampleNode = NewObject<UMaterialExpressionTextureSample>(CreatedMaterial);
 
 	if (!TextureSampleNode) return;
 
-	//   
+	// 핀 연결 가능
 	if (!CreatedMaterial->HasBaseColorConnected())
 	{
 		if (TryConnectBaseColor(TextureSampleNode, SelectedTexture, CreatedMaterial))
@@ -269,11 +269,11 @@ bool UQuickMaterialCreationWidget::TryConnectBaseColor(
 	{
 		if (SelectedTexture->GetName().Contains(BaseColorName))
 		{
-			// ̽÷ ؽó ⼭ ̾ش.
+			// 베이스컬러 텍스처를 여기서 이어준다.
 			TextureSampleNode->Texture = SelectedTexture;
-			// UE 5.1.1  Ʒ ڵ Ұ.
+			// UE 5.1.1 부터 아래 코드 불가.
 			//CreatedMaterial->Expression.Add(TextureSampleNode);
-			// Ʒ   .
+			// 아래와 같이 사용할 것.
 			CreatedMaterial->GetEditorOnlyData()->ExpressionCollection.Expressions.Add(TextureSampleNode);
 			CreatedMaterial->GetEditorOnlyData()->BaseColor.Expression = TextureSampleNode;
 			CreatedMaterial->GetEditorOnlyData()->PostEditChange();
@@ -295,7 +295,7 @@ bool UQuickMaterialCreationWidget::TryConnectMetalic(
 	{
 		if (SelectedTexture->GetName().Contains(MetalicName))
 		{
-			// Ż ؽó ⼭ ̾ش.
+			// 메탈릭 텍스처를 여기서 이어준다.
 			SelectedTexture->CompressionSettings = TextureCompressionSettings::TC_Default;
 			SelectedTexture->SRGB = false;
 			SelectedTexture->PostEditChange();
@@ -323,7 +323,7 @@ bool UQuickMaterialCreationWidget::TryConnectRoughness(UMaterialExpressionTextur
 	{
 		if (SelectedTexture->GetName().Contains(RoughnessName))
 		{
-			// Ż ؽó ⼭ ̾ش.
+			// 메탈릭 텍스처를 여기서 이어준다.
 			SelectedTexture->CompressionSettings = TextureCompressionSettings::TC_Default;
 			SelectedTexture->SRGB = false;
 			SelectedTexture->PostEditChange();
@@ -372,7 +372,7 @@ bool UQuickMaterialCreationWidget::TryConnectAO(UMaterialExpressionTextureSample
 	{
 		if (SelectedTexture->GetName().Contains(AOName))
 		{
-			// Ż ؽó ⼭ ̾ش.
+			// 메탈릭 텍스처를 여기서 이어준다.
 			SelectedTexture->CompressionSettings = TextureCompressionSettings::TC_Default;
 			SelectedTexture->SRGB = false;
 			SelectedTexture->PostEditChange();
@@ -399,7 +399,7 @@ bool UQuickMaterialCreationWidget::TryConnectORM(UMaterialExpressionTextureSampl
 	{
 		if (SelectedTexture->GetName().Contains(ORM_Name))
 		{
-			// Ż ؽó ⼭ ̾ش.
+			// 메탈릭 텍스처를 여기서 이어준다.
 			SelectedTexture->CompressionSettings = TextureCompressionSettings::TC_Masks;
 			SelectedTexture->SRGB = false;
 			SelectedTexture->PostEditChange();
@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerAssetScan.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "Async/Async.h"
+
+namespace SuperManagerAssetScan
+{
+	// Matches are published to the game thread this many assets at a time
+	static const int32 PublishBatchSize = 4096;
+}
+
+FSuperManagerAssetScan::FSuperManagerAssetScan(
+	const TSharedRef<FSuperManagerAssetTable>& InAssetTable, const TArray<FSuperManagerAssetRowId>& InRowsToScan,
+	FPackagePredicate InPredicate, bool bInGatherPackageSizes)
+	: AssetTable(InAssetTable)
+	, RowsToScan(InRowsToScan)
+	, Predicate(MoveTemp(InPredicate))
+	, NumWorkers(SuperManagerParallel::GetNumWorkers())
+	, bGatherPackageSizes(bInGatherPackageSizes)
+{
+}
+
+FSuperManagerAssetScan::~FSuperManagerAssetScan()
+{
+	Cancel();
+}
+
+void FSuperManagerAssetScan::Start()
+{
+	// The worker holds a reference so the tab can drop the scan at any time
+	TSharedRef<FSuperManagerAssetScan> ThisScan = AsShared();
+
+	ScanFuture = Async(EAsyncExecution::ThreadPool, [ThisScan]()
+	{
+		ThisScan->Run();
+	});
+}
+
+void FSuperManagerAssetScan::Cancel()
+{
+	bCancelRequested = true;
+}
+
+bool FSuperManagerAssetScan::IsComplete() const
+{
+	if (!bWorkerFinished) return false;
+
+	FScopeLock ScopeLock(&PendingResultsLock);
+	return PendingResults.Num() == 0;
+}
+
+float FSuperManagerAssetScan::GetProgress() const
+{
+	if (RowsToScan.Num() == 0) return 1.f;
+
+	return static_cast<float>(NumScanned) / static_cast<float>(RowsToScan.Num());
+}
+
+void FSuperManagerAssetScan::ConsumeResults(TArray<FSuperManagerAssetRowId>& OutResults, int32 MaxResults)
+{
+	FScopeLock ScopeLock(&PendingResultsLock);
+
+	const int32 NumToConsume = FMath::Min(MaxResults, PendingResults.Num());
+	if (NumToConsume <= 0) return;
+
+	// Sizes go into the table first so no row is shown before its size
+	if (PendingPackageSizes.Num() > 0)
+	{
+		for (int32 ResultIndex = 0; ResultIndex < NumToConsume; ++ResultIndex)
+		{
+			const FSuperManagerAssetRowId Row = PendingResults[ResultIndex];
+
+			if (const FSuperManagerPackageSize* PackageSize = PendingPackageSizes.Find(AssetTable->GetPackageName(Row)))
+			{
+				AssetTable->SetSize(Row, *PackageSize);
+			}
+		}
+	}
+
+	OutResults.Append(PendingResults.GetData(), NumToConsume);
+	PendingResults.RemoveAt(0, NumToConsume, false);
+
+	if (PendingResults.Num() == 0)
+	{
+		PendingPackageSizes.Reset();
+	}
+}
+
+void FSuperManagerAssetScan::Run()
+{
+	TArray<FSuperManagerAssetRowId> BatchResults;
+	TArray<FName> BatchPackageNames;
+	TMap<FName, FSuperManagerPackageSize> BatchPackageSizes;
+
+	const FSuperManagerAssetTable& Table = *AssetTable;
+
+	if (Prepare && !bCancelRequested)
+	{
+		Prepare();
+	}
+
+	for (int32 BatchStart = 0; BatchStart < RowsToScan.Num(); BatchStart += SuperManagerAssetScan::PublishBatchSize)
+	{
+		if (bCancelRequested) break;
+
+		const int32 BatchEnd = FMath::Min(BatchStart + SuperManagerAssetScan::PublishBatchSize, RowsToScan.Num());
+
+		// Each batch is split across the workers, matches keep the input order
+		SuperManagerParallel::ParallelGather(BatchEnd - BatchStart, NumWorkers, BatchResults,
+			[this, &Table, BatchStart](int32 BatchIndex, TArray<FSuperManagerAssetRowId>& ChunkResults)
+			{
+				const FSuperManagerAssetRowId Row = RowsToScan[BatchStart + BatchIndex];
+
+				if (Predicate(Table.GetPackageName(Row)))
+				{
+					ChunkResults.Add(Row);
+				}
+			});
+
+		if (bGatherPackageSizes && !bCancelRequested)
+		{
+			for (const FSuperManagerAssetRowId& Row : BatchResults)
+			{
+				BatchPackageNames.Add(Table.GetPackageName(Row));
+			}
+
+			SuperManagerPackageSizes::GatherPackageSizes(BatchPackageNames, BatchPackageSizes, NumWorkers);
+		}
+
+		if (BatchResults.Num() > 0)
+		{
+			FScopeLock ScopeLock(&PendingResultsLock);
+			PendingResults.Append(BatchResults);
+			PendingPackageSizes.Append(BatchPackageSizes);
+		}
+
+		BatchResults.Reset();
+		BatchPackageNames.Reset();
+		BatchPackageSizes.Reset();
+		NumScanned = BatchEnd;
+	}
+
+	bWorkerFinished = true;
+}
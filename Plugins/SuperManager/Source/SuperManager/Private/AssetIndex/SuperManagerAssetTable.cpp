@@ -0,0 +1,168 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+void FSuperManagerAssetTable::Reserve(int32 NumRows)
+{
+	PackageNames.Reserve(NumRows);
+	AssetNames.Reserve(NumRows);
+	ClassIndices.Reserve(NumRows);
+	Flags.Reserve(NumRows);
+	ReferencerCounts.Reserve(NumRows);
+	DiskBytes.Reserve(NumRows);
+	EstimatedCookedBytes.Reserve(NumRows);
+	ModifiedTicks.Reserve(NumRows);
+}
+
+FSuperManagerAssetRowId FSuperManagerAssetTable::AddAsset(const FAssetData& AssetData)
+{
+	uint16* ClassIndex = ClassIndexByPath.Find(AssetData.AssetClassPath);
+
+	if (!ClassIndex)
+	{
+		check(Classes.Num() < MAX_uint16);
+		ClassIndex = &ClassIndexByPath.Add(AssetData.AssetClassPath, static_cast<uint16>(Classes.Add(AssetData.AssetClassPath)));
+	}
+
+	PackageNames.Add(AssetData.PackageName);
+	AssetNames.Add(AssetData.AssetName);
+	ClassIndices.Add(*ClassIndex);
+	Flags.Add(AssetData.IsRedirector() ? ESuperManagerAssetRowFlags::Redirector : ESuperManagerAssetRowFlags::None);
+	ReferencerCounts.Add(0);
+	DiskBytes.Add(0);
+	EstimatedCookedBytes.Add(0);
+	ModifiedTicks.Add(0);
+
+	if (RowsByPackage.Num() > 0)
+	{
+		RowsByPackage.Add(AssetData.PackageName, PackageNames.Num() - 1);
+	}
+
+	return FSuperManagerAssetRowId(PackageNames.Num() - 1);
+}
+
+void FSuperManagerAssetTable::GetAllRows(TArray<FSuperManagerAssetRowId>& OutRows) const
+{
+	OutRows.Reset(Num());
+
+	for (int32 RowIndex = 0; RowIndex < Num(); ++RowIndex)
+	{
+		OutRows.Add(FSuperManagerAssetRowId(RowIndex));
+	}
+}
+
+FSoftObjectPath FSuperManagerAssetTable::GetObjectPath(FSuperManagerAssetRowId Row) const
+{
+	return FSoftObjectPath(FTopLevelAssetPath(PackageNames[Row.Index], AssetNames[Row.Index]), FString());
+}
+
+FAssetData FSuperManagerAssetTable::FindAssetData(FSuperManagerAssetRowId Row) const
+{
+	return IAssetRegistry::GetChecked().GetAssetByObjectPath(GetObjectPath(Row), true);
+}
+
+void FSuperManagerAssetTable::FindRows(FName PackageName, TArray<FSuperManagerAssetRowId>& OutRows)
+{
+	OutRows.Reset();
+
+	if (RowsByPackage.Num() != Num())
+	{
+		RowsByPackage.Reset();
+		RowsByPackage.Reserve(Num());
+
+		for (int32 RowIndex = 0; RowIndex < Num(); ++RowIndex)
+		{
+			RowsByPackage.Add(PackageNames[RowIndex], RowIndex);
+		}
+	}
+
+	for (TMultiMap<FName, int32>::TConstKeyIterator It(RowsByPackage, PackageName); It; ++It)
+	{
+		OutRows.Add(FSuperManagerAssetRowId(It.Value()));
+	}
+}
+
+FSuperManagerAssetRowId FSuperManagerAssetTable::FindRow(const FSoftObjectPath& ObjectPath)
+{
+	TArray<FSuperManagerAssetRowId> PackageRows;
+	FindRows(ObjectPath.GetLongPackageFName(), PackageRows);
+
+	for (const FSuperManagerAssetRowId& Row : PackageRows)
+	{
+		if (AssetNames[Row.Index] == ObjectPath.GetAssetFName() && !HasFlags(Row, ESuperManagerAssetRowFlags::Deleted))
+		{
+			return Row;
+		}
+	}
+
+	return FSuperManagerAssetRowId();
+}
+
+FSuperManagerPackageSize FSuperManagerAssetTable::GetSize(FSuperManagerAssetRowId Row) const
+{
+	FSuperManagerPackageSize Size;
+	Size.DiskBytes = DiskBytes[Row.Index];
+	Size.EstimatedCookedBytes = EstimatedCookedBytes[Row.Index];
+
+	return Size;
+}
+
+void FSuperManagerAssetTable::SetSize(FSuperManagerAssetRowId Row, const FSuperManagerPackageSize& Size)
+{
+	DiskBytes[Row.Index] = Size.DiskBytes;
+	EstimatedCookedBytes[Row.Index] = Size.EstimatedCookedBytes;
+	SetFlags(Row, ESuperManagerAssetRowFlags::SizeKnown);
+}
+
+void FSuperManagerAssetTable::BuildSortKeys()
+{
+	// Distinct names are ranked once, every row then takes the rank of its name
+	auto RankNames = [](const TArray<FName>& Names, TArray<uint32>& OutSortKeys)
+	{
+		TArray<FName> DistinctNames = TSet<FName>(Names).Array();
+
+		DistinctNames.Sort([](const FName& A, const FName& B)
+		{
+			return A.LexicalLess(B);
+		});
+
+		TMap<FName, uint32> RankByName;
+		RankByName.Reserve(DistinctNames.Num());
+
+		for (int32 Rank = 0; Rank < DistinctNames.Num(); ++Rank)
+		{
+			RankByName.Add(DistinctNames[Rank], static_cast<uint32>(Rank));
+		}
+
+		OutSortKeys.SetNumUninitialized(Names.Num());
+
+		for (int32 RowIndex = 0; RowIndex < Names.Num(); ++RowIndex)
+		{
+			OutSortKeys[RowIndex] = RankByName.FindChecked(Names[RowIndex]);
+		}
+	};
+
+	RankNames(AssetNames, NameSortKeys);
+	RankNames(PackageNames, PathSortKeys);
+
+	TArray<FName> ClassNames;
+	ClassNames.Reserve(Classes.Num());
+
+	for (const FTopLevelAssetPath& ClassPath : Classes)
+	{
+		ClassNames.Add(ClassPath.GetAssetName());
+	}
+
+	RankNames(ClassNames, ClassSortKeys);
+}
+
+SIZE_T FSuperManagerAssetTable::GetAllocatedSize() const
+{
+	return PackageNames.GetAllocatedSize() + AssetNames.GetAllocatedSize() + ClassIndices.GetAllocatedSize()
+		+ Flags.GetAllocatedSize() + ReferencerCounts.GetAllocatedSize() + DiskBytes.GetAllocatedSize()
+		+ EstimatedCookedBytes.GetAllocatedSize() + ModifiedTicks.GetAllocatedSize()
+		+ NameSortKeys.GetAllocatedSize() + PathSortKeys.GetAllocatedSize() + ClassSortKeys.GetAllocatedSize()
+		+ RowsByPackage.GetAllocatedSize() + Classes.GetAllocatedSize() + ClassIndexByPath.GetAllocatedSize();
+}
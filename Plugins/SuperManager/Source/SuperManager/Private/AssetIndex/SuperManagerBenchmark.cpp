@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "DebugHeader.h"
+
+FSuperManagerBenchmark::FSuperManagerBenchmark(const TCHAR* InCommandName, const TCHAR* Help, FRunFunction Run)
+	: CommandName(InCommandName)
+	, ConsoleCommand(InCommandName, Help, FConsoleCommandWithArgsDelegate::CreateLambda([this, Run](const TArray<FString>& Args)
+		{
+			Run(*this, Args);
+		}))
+{
+}
+
+void FSuperManagerBenchmark::LogResult(const TCHAR* PassName, const FString& Details) const
+{
+	DebugHeader::PrintLog(FString::Printf(TEXT("%s : %-32s %s"), CommandName, PassName, *Details));
+}
+
+void FSuperManagerBenchmark::LogMessage(const FString& Message) const
+{
+	DebugHeader::PrintLog(FString::Printf(TEXT("%s : %s"), CommandName, *Message));
+}
+
+FString FSuperManagerBenchmark::GetPackagePathArgument(const TArray<FString>& Args)
+{
+	return Args.Num() > 0 ? Args[0] : TEXT("/Game");
+}
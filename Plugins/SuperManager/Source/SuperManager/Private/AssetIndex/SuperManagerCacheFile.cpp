@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerCacheFile.h"
+
+namespace SuperManagerCacheFile
+{
+	bool FitsInRemaining(FArchive& Reader, int64 Count, int64 ElementBytes)
+	{
+		return Count >= 0 && Count <= (Reader.TotalSize() - Reader.Tell()) / ElementBytes;
+	}
+
+	bool ReadString(FArchive& Reader, FString& OutString)
+	{
+		// Negative lengths are UTF-16 strings
+		const int64 StartOffset = Reader.Tell();
+
+		int32 SaveNum = 0;
+		Reader << SaveNum;
+
+		const int64 NumChars = SaveNum < 0 ? -static_cast<int64>(SaveNum) : SaveNum;
+		const int64 CharBytes = SaveNum < 0 ? sizeof(UTF16CHAR) : sizeof(ANSICHAR);
+
+		if (Reader.IsError() || !FitsInRemaining(Reader, NumChars, CharBytes)) return false;
+
+		Reader.Seek(StartOffset);
+		Reader << OutString;
+
+		return !Reader.IsError();
+	}
+}
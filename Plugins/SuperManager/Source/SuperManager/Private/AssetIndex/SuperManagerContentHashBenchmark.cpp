@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerContentHashes.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "Misc/PackageName.h"
+#include "SuperManager.h"
+
+/**
+ * SuperManager.BenchmarkContentHash [PackagePath]
+ * Times content duplicate detection over every package under PackagePath (default /Game) :
+ * hashing every package file without the cache (once, it reads the whole folder), the same packages through
+ * the cache (a file stat each), and grouping the copies. Run it once on a cold disk for the read throughput.
+ */
+namespace SuperManagerContentHashBenchmark
+{
+	static void LogResult(const FSuperManagerBenchmark& Benchmark, const TCHAR* PassName, int32 NumPackages, double Seconds,
+		const FString& Details)
+	{
+		Benchmark.LogResult(PassName, FString::Printf(TEXT("%d packages, %.1f ms, %s"), NumPackages, Seconds * 1000.0, *Details));
+	}
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		const FString FolderPath = FSuperManagerBenchmark::GetPackagePathArgument(Args);
+
+		FSuperManagerModule& SuperManagerModule =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+		const TSharedRef<FSuperManagerAssetTable> AssetTable = SuperManagerModule.BuildAssetTableUnderFolders({ FolderPath });
+
+		TArray<FSuperManagerAssetRowId> AllRows;
+		AssetTable->GetAllRows(AllRows);
+
+		TArray<FSuperManagerAssetRowId> PackageRows;
+		SuperManagerContentHashes::GatherUniquePackages(*AssetTable, AllRows, PackageRows);
+
+		if (PackageRows.Num() == 0)
+		{
+			Benchmark.LogMessage(TEXT("no assets under ") + FolderPath);
+			return;
+		}
+
+		const int32 NumWorkers = SuperManagerParallel::GetNumWorkers();
+
+		// Cold : every file is read once, the cache is neither used nor filled
+		int64 TotalPayloadBytes = 0;
+
+		double Seconds = FSuperManagerBenchmark::TimePass([&AssetTable, &PackageRows, NumWorkers]()
+			{
+				TArray<int64> PayloadBytes;
+
+				SuperManagerParallel::ParallelGather(PackageRows.Num(), NumWorkers, PayloadBytes,
+					[&AssetTable, &PackageRows](int32 PackageIndex, TArray<int64>& ChunkPayloadBytes)
+					{
+						FString PackageFilename;
+						if (!FPackageName::DoesPackageExist(AssetTable->GetPackageName(PackageRows[PackageIndex]).ToString(), &PackageFilename)) return;
+
+						ChunkPayloadBytes.Add(FSuperManagerContentHashCache::HashPackageFile(PackageFilename).PayloadBytes);
+					});
+
+				int64 Total = 0;
+
+				for (const int64 Bytes : PayloadBytes)
+				{
+					Total += Bytes;
+				}
+
+				return Total;
+			}, TotalPayloadBytes, 1);
+
+		LogResult(Benchmark, TEXT("Hash files (no cache)"), PackageRows.Num(), Seconds, FString::Printf(TEXT("%s hashed, %.1f MB/s, %d workers"),
+			*FText::AsMemory(TotalPayloadBytes).ToString(), TotalPayloadBytes / (1024.0 * 1024.0) / FMath::Max(Seconds, 1e-6), NumWorkers));
+
+		// Fills the cache outside the timings, packages hashed in an earlier session are only checked
+		FSuperManagerContentHashCache& Cache = SuperManagerModule.GetContentHashCache();
+		SuperManagerContentHashes::HashPackages(Cache, *AssetTable, AllRows, NumWorkers);
+
+		int32 NumHashed = 0;
+
+		Seconds = FSuperManagerBenchmark::TimePass([&Cache, &AssetTable, &AllRows, NumWorkers]()
+			{
+				return SuperManagerContentHashes::HashPackages(Cache, *AssetTable, AllRows, NumWorkers);
+			}, NumHashed);
+
+		LogResult(Benchmark, TEXT("Hash through the cache"), PackageRows.Num(), Seconds,
+			FString::Printf(TEXT("%d with a payload, %d cached entries"), NumHashed, Cache.Num()));
+
+		int32 NumDuplicateRows = 0;
+
+		Seconds = FSuperManagerBenchmark::TimePass([&SuperManagerModule, &AssetTable, &AllRows]()
+			{
+				TArray<FSuperManagerAssetRowId> DuplicateRows;
+				SuperManagerModule.ListContentDuplicatesForAssetList(*AssetTable, AllRows, DuplicateRows);
+
+				return DuplicateRows.Num();
+			}, NumDuplicateRows);
+
+		LogResult(Benchmark, TEXT("Group copies"), PackageRows.Num(), Seconds, FString::Printf(TEXT("%d duplicate assets"), NumDuplicateRows));
+	}
+
+	static FSuperManagerBenchmark BenchmarkContentHash(TEXT("SuperManager.BenchmarkContentHash"),
+		TEXT("Measure content hashing with and without the hash cache, and copy grouping. Optional argument : package path"),
+		&Run);
+}
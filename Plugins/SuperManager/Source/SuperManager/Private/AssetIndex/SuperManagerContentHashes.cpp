@@ -0,0 +1,494 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerContentHashes.h"
+#include "AssetIndex/SuperManagerCacheFile.h"
+#include "AssetIndex/SuperManagerNameGroups.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "Misc/PackageName.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ArchiveProxy.h"
+#include "UObject/PackageFileSummary.h"
+#include "UObject/ObjectResource.h"
+#include "Hash/CityHash.h"
+
+namespace SuperManagerContentHashCache
+{
+	static const uint32 Magic = 0x534D4348;	// "SMCH"
+	static const uint32 Version = 3;
+
+	// Smallest entry on disk : empty name, timestamp, file size, hash, payload size
+	static const int64 MinEntryBytes = sizeof(int32) + sizeof(int64) + sizeof(int64) + sizeof(uint64) + sizeof(int64);
+
+	// Large enough to keep the disk busy, small enough for every worker to hold one
+	static const int64 ChunkBytes = 1024 * 1024;
+
+	// Bulk data the editor wrote next to the package file
+	static const TCHAR* SplitBulkDataExtensions[] = { TEXT(".ubulk"), TEXT(".uptnl") };
+
+	static bool FindPackageFile(FName PackageName, FString& OutPackageFilename, FFileStatData& OutStatData)
+	{
+		FString PackageFilename;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName.ToString(), PackageFilename)) return false;
+
+		for (const FString& Extension : { FPackageName::GetAssetPackageExtension(), FPackageName::GetMapPackageExtension() })
+		{
+			OutStatData = IFileManager::Get().GetStatData(*(PackageFilename + Extension));
+
+			if (OutStatData.bIsValid && !OutStatData.bIsDirectory)
+			{
+				OutPackageFilename = PackageFilename + Extension;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/** Chain NumBytes of Reader from Offset into InOutHash, one chunk at a time */
+	static bool HashRange(FArchive& Reader, int64 Offset, int64 NumBytes, TArray<uint8>& Buffer, uint64& InOutHash)
+	{
+		if (NumBytes <= 0) return true;
+
+		if (Buffer.Num() < FMath::Min(NumBytes, ChunkBytes))
+		{
+			Buffer.SetNumUninitialized(FMath::Min(NumBytes, ChunkBytes));
+		}
+
+		Reader.Seek(Offset);
+
+		while (NumBytes > 0)
+		{
+			const int64 NumToRead = FMath::Min(NumBytes, ChunkBytes);
+
+			Reader.Serialize(Buffer.GetData(), NumToRead);
+			if (Reader.IsError()) return false;
+
+			InOutHash = CityHash64WithSeed(reinterpret_cast<const char*>(Buffer.GetData()), static_cast<uint32>(NumToRead), InOutHash);
+			NumBytes -= NumToRead;
+		}
+
+		return true;
+	}
+
+	static void HashString(const FString& String, uint64& InOutHash)
+	{
+		InOutHash = CityHash64WithSeed(reinterpret_cast<const char*>(*String), String.Len() * sizeof(TCHAR), InOutHash);
+	}
+
+	/** The package's own path and asset name, hashed as empty strings so copies under other names still match */
+	struct FOwnNames
+	{
+		FString LongPackageName;
+		FString AssetName;
+
+		FString Blank(FName Name) const
+		{
+			const FString NameString = Name.ToString();
+
+			return NameString.Equals(LongPackageName, ESearchCase::IgnoreCase) || NameString.Equals(AssetName, ESearchCase::IgnoreCase)
+				? FString() : NameString;
+		}
+	};
+
+	/** Reads names as the package stores them, an index into its name table and a number */
+	class FNameTableReader : public FArchiveProxy
+	{
+	public:
+		FNameTableReader(FArchive& InReader, const TArray<FName>& InNames)
+			: FArchiveProxy(InReader)
+			, Names(InNames)
+		{
+		}
+
+		using FArchiveProxy::operator<<;
+
+		virtual FArchive& operator<<(FName& Name) override
+		{
+			int32 NameIndex = 0;
+			int32 Number = 0;
+			InnerArchive << NameIndex << Number;
+
+			if (!Names.IsValidIndex(NameIndex))
+			{
+				SetError();
+				Name = NAME_None;
+				return *this;
+			}
+
+			Name = FName(Names[NameIndex], Number);
+			return *this;
+		}
+
+	private:
+		const TArray<FName>& Names;
+	};
+
+	static bool ReadNameTable(FArchive& Reader, const FPackageFileSummary& Summary, TArray<FName>& OutNames)
+	{
+		if (Summary.NameCount <= 0) return true;
+		if (Summary.NameOffset <= 0 || Summary.NameOffset >= Reader.TotalSize()) return false;
+
+		Reader.Seek(Summary.NameOffset);
+		if (!SuperManagerCacheFile::FitsInRemaining(Reader, Summary.NameCount, sizeof(int32))) return false;
+
+		OutNames.Reserve(Summary.NameCount);
+
+		for (int32 NameIndex = 0; NameIndex < Summary.NameCount; ++NameIndex)
+		{
+			FNameEntrySerialized NameEntry(ENAME_LinkerConstructor);
+			Reader << NameEntry;
+
+			if (Reader.IsError()) return false;
+
+			OutNames.Add(FName(NameEntry));
+		}
+
+		return true;
+	}
+
+	/**
+	 * Chain the names the exports refer to into InOutHash, in name table order so each index the exports hold
+	 * stands for the same string in both copies
+	 */
+	static void HashExportNames(const FPackageFileSummary& Summary, const TArray<FName>& Names, const FOwnNames& OwnNames,
+		uint64& InOutHash)
+	{
+		// Names after these are only used by the header
+		const int32 NumExportNames = FMath::Clamp(Summary.NamesReferencedFromExportDataCount, 0, Names.Num());
+
+		for (int32 NameIndex = 0; NameIndex < NumExportNames; ++NameIndex)
+		{
+			HashString(OwnNames.Blank(Names[NameIndex]), InOutHash);
+		}
+	}
+
+	/**
+	 * Chain the import table into InOutHash, in order : export data points at other assets through import indices,
+	 * so two material instances differing only in a texture parameter differ here. Outers are import indices too,
+	 * hashing them with the rest of the table covers each import's outer chain
+	 */
+	static bool HashImports(FArchive& Reader, const FPackageFileSummary& Summary, const TArray<FName>& Names,
+		const FOwnNames& OwnNames, uint64& InOutHash)
+	{
+		// Class package, class name, outer index, object name
+		static const int64 MinImportBytes = 3 * (sizeof(int32) + sizeof(int32)) + sizeof(int32);
+
+		if (Summary.ImportCount <= 0) return true;
+		if (Summary.ImportOffset <= 0 || Summary.ImportOffset >= Reader.TotalSize()) return false;
+
+		Reader.Seek(Summary.ImportOffset);
+		if (!SuperManagerCacheFile::FitsInRemaining(Reader, Summary.ImportCount, MinImportBytes)) return false;
+
+		FNameTableReader ImportReader(Reader, Names);
+
+		for (int32 ImportIndex = 0; ImportIndex < Summary.ImportCount; ++ImportIndex)
+		{
+			FObjectImport Import;
+			ImportReader << Import;
+
+			if (Reader.IsError() || ImportReader.IsError()) return false;
+
+			HashString(OwnNames.Blank(Import.ClassPackage), InOutHash);
+			HashString(OwnNames.Blank(Import.ClassName), InOutHash);
+			HashString(OwnNames.Blank(Import.ObjectName), InOutHash);
+
+			const int32 OuterIndex = Import.OuterIndex.ForDebugging();
+			InOutHash = CityHash64WithSeed(reinterpret_cast<const char*>(&OuterIndex), sizeof(OuterIndex), InOutHash);
+		}
+
+		return true;
+	}
+}
+
+FSuperManagerContentHash FSuperManagerContentHashCache::GetContentHash(FName PackageName)
+{
+	FString PackageFilename;
+	FFileStatData StatData;
+	if (!SuperManagerContentHashCache::FindPackageFile(PackageName, PackageFilename, StatData)) return FSuperManagerContentHash();
+
+	FCacheEntry Entry;
+	Entry.TimeStamp = StatData.ModificationTime.GetTicks();
+	Entry.FileSize = StatData.FileSize;
+
+	{
+		FReadScopeLock ReadLock(CacheLock);
+
+		const FCacheEntry* CachedEntry = Entries.Find(PackageName);
+
+		if (CachedEntry && CachedEntry->TimeStamp == Entry.TimeStamp && CachedEntry->FileSize == Entry.FileSize)
+		{
+			return CachedEntry->ContentHash;
+		}
+	}
+
+	// Hashed outside the lock, other workers keep reading the cache meanwhile
+	Entry.ContentHash = HashPackageFile(PackageFilename);
+
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		Entries.Add(PackageName, Entry);
+	}
+
+	bDirty = true;
+
+	return Entry.ContentHash;
+}
+
+FSuperManagerContentHash FSuperManagerContentHashCache::FindContentHash(FName PackageName) const
+{
+	FReadScopeLock ReadLock(CacheLock);
+
+	const FCacheEntry* CachedEntry = Entries.Find(PackageName);
+
+	return CachedEntry ? CachedEntry->ContentHash : FSuperManagerContentHash();
+}
+
+FSuperManagerContentHash FSuperManagerContentHashCache::HashPackageFile(const FString& PackageFilename)
+{
+	FSuperManagerContentHash ContentHash;
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*PackageFilename, FILEREAD_Silent));
+	if (!Reader.IsValid()) return ContentHash;
+
+	FPackageFileSummary Summary;
+	*Reader << Summary;
+
+	if (Reader->IsError() || Summary.Tag != PACKAGE_FILE_TAG || Summary.TotalHeaderSize <= 0) return ContentHash;
+
+	// The name and import tables are read the way the package was saved
+	Reader->SetUEVer(Summary.GetFileVersionUE());
+	Reader->SetLicenseeUEVer(Summary.GetFileVersionLicenseeUE());
+	Reader->SetCustomVersions(Summary.GetCustomVersionContainer());
+	Reader->SetFilterEditorOnly((Summary.GetPackageFlags() & PKG_FilterEditorOnly) != 0);
+
+	SuperManagerContentHashCache::FOwnNames OwnNames;
+	if (!FPackageName::TryConvertFilenameToLongPackageName(PackageFilename, OwnNames.LongPackageName)) return ContentHash;
+
+	OwnNames.AssetName = FPackageName::GetShortName(OwnNames.LongPackageName);
+
+	TArray<FName> Names;
+	if (!SuperManagerContentHashCache::ReadNameTable(*Reader, Summary, Names)) return ContentHash;
+
+	uint64 Hash = 0;
+
+	// Export data stores names and object references as table indices, what they stand for is part of the content
+	SuperManagerContentHashCache::HashExportNames(Summary, Names, OwnNames, Hash);
+
+	if (!SuperManagerContentHashCache::HashImports(*Reader, Summary, Names, OwnNames, Hash)) return ContentHash;
+
+	// Every package file ends with a copy of the file tag
+	const int64 ExportsStart = FMath::Min<int64>(Summary.TotalHeaderSize, Reader->TotalSize());
+	const int64 PayloadEnd = FMath::Max<int64>(Reader->TotalSize() - static_cast<int64>(sizeof(uint32)), ExportsStart);
+
+	// Exports, then inline bulk data and the payload trailer. Texture settings and collision live in the exports,
+	// the materials and textures they point at in the imports, so two imports of one source file only match if they
+	// were also set up the same way
+	TArray<uint8> Buffer;
+
+	if (!SuperManagerContentHashCache::HashRange(*Reader, ExportsStart, PayloadEnd - ExportsStart, Buffer, Hash)) return ContentHash;
+
+	int64 PayloadBytes = PayloadEnd - ExportsStart;
+
+	// Bulk data the editor wrote next to the package file. Empty files hold no payload and are left out
+	for (const TCHAR* Extension : SuperManagerContentHashCache::SplitBulkDataExtensions)
+	{
+		TUniquePtr<FArchive> SplitReader(FileManager.CreateFileReader(*FPaths::ChangeExtension(PackageFilename, Extension), FILEREAD_Silent));
+		if (!SplitReader.IsValid() || SplitReader->TotalSize() <= 0) continue;
+
+		// Tagged with its extension, so payload bytes cannot be taken for the next file's
+		SuperManagerContentHashCache::HashString(Extension, Hash);
+
+		if (!SuperManagerContentHashCache::HashRange(*SplitReader, 0, SplitReader->TotalSize(), Buffer, Hash)) return ContentHash;
+
+		PayloadBytes += SplitReader->TotalSize();
+	}
+
+	ContentHash.Hash = Hash;
+	ContentHash.PayloadBytes = PayloadBytes;
+
+	return ContentHash;
+}
+
+int32 FSuperManagerContentHashCache::Num() const
+{
+	FReadScopeLock ReadLock(CacheLock);
+
+	return Entries.Num();
+}
+
+#pragma region PersistentCache
+
+FString FSuperManagerContentHashCache::GetDefaultCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SuperManager") / TEXT("ContentHashes.bin");
+}
+
+bool FSuperManagerContentHashCache::LoadFromCache(const FString& CacheFilename)
+{
+	TArray<uint8> CacheBytes;
+	if (!FFileHelper::LoadFileToArray(CacheBytes, *CacheFilename, FILEREAD_Silent)) return false;
+
+	FMemoryReader Reader(CacheBytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumEntries = 0;
+
+	Reader << Magic << Version << NumEntries;
+
+	if (Reader.IsError() || Magic != SuperManagerContentHashCache::Magic ||
+		Version != SuperManagerContentHashCache::Version ||
+		!SuperManagerCacheFile::FitsInRemaining(Reader, NumEntries, SuperManagerContentHashCache::MinEntryBytes))
+	{
+		return false;
+	}
+
+	TMap<FName, FCacheEntry> LoadedEntries;
+	LoadedEntries.Reserve(NumEntries);
+
+	FString PackageNameString;
+
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Reader.IsError(); ++EntryIndex)
+	{
+		FCacheEntry Entry;
+
+		if (!SuperManagerCacheFile::ReadString(Reader, PackageNameString)) return false;
+
+		Reader << Entry.TimeStamp << Entry.FileSize << Entry.ContentHash.Hash << Entry.ContentHash.PayloadBytes;
+
+		LoadedEntries.Add(FName(*PackageNameString), Entry);
+	}
+
+	if (Reader.IsError()) return false;
+
+	FWriteScopeLock WriteLock(CacheLock);
+
+	Entries = MoveTemp(LoadedEntries);
+	bDirty = false;
+
+	return true;
+}
+
+bool FSuperManagerContentHashCache::SaveToCache(const FString& CacheFilename)
+{
+	FReadScopeLock ReadLock(CacheLock);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CacheFilename));
+	if (!Writer.IsValid()) return false;
+
+	uint32 Magic = SuperManagerContentHashCache::Magic;
+	uint32 Version = SuperManagerContentHashCache::Version;
+	int32 NumEntries = Entries.Num();
+
+	*Writer << Magic << Version << NumEntries;
+
+	for (const TPair<FName, FCacheEntry>& Entry : Entries)
+	{
+		FString PackageNameString = Entry.Key.ToString();
+		FCacheEntry SavedEntry = Entry.Value;
+
+		*Writer << PackageNameString << SavedEntry.TimeStamp << SavedEntry.FileSize
+			<< SavedEntry.ContentHash.Hash << SavedEntry.ContentHash.PayloadBytes;
+	}
+
+	if (!Writer->Close()) return false;
+
+	bDirty = false;
+
+	return true;
+}
+
+#pragma endregion
+
+namespace SuperManagerContentHashes
+{
+	void GatherUniquePackages(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		TArray<FSuperManagerAssetRowId>& OutPackageRows)
+	{
+		TSet<FName> SeenPackages;
+		SeenPackages.Reserve(Rows.Num());
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			bool bAlreadySeen = false;
+			SeenPackages.Add(AssetTable.GetPackageName(Row), &bAlreadySeen);
+
+			if (!bAlreadySeen)
+			{
+				OutPackageRows.Add(Row);
+			}
+		}
+	}
+
+	int32 HashPackages(FSuperManagerContentHashCache& Cache, const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& Rows, int32 NumWorkers)
+	{
+		TArray<FSuperManagerAssetRowId> PackageRows;
+		GatherUniquePackages(AssetTable, Rows, PackageRows);
+
+		TArray<FName> HashedPackages;
+
+		SuperManagerParallel::ParallelGather(PackageRows.Num(), NumWorkers, HashedPackages,
+			[&Cache, &AssetTable, &PackageRows](int32 PackageIndex, TArray<FName>& ChunkHashedPackages)
+			{
+				const FName PackageName = AssetTable.GetPackageName(PackageRows[PackageIndex]);
+
+				if (Cache.GetContentHash(PackageName).IsValid())
+				{
+					ChunkHashedPackages.Add(PackageName);
+				}
+			});
+
+		return HashedPackages.Num();
+	}
+
+	void GroupDuplicateRows(const FSuperManagerContentHashCache& Cache, const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& Rows, TArray<FSuperManagerAssetRowId>& OutDuplicateRows)
+	{
+		OutDuplicateRows.Reset();
+
+		TArray<FSuperManagerAssetRowId> HashedRows;
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			if (Cache.FindContentHash(AssetTable.GetPackageName(Row)).IsValid())
+			{
+				HashedRows.Add(Row);
+			}
+		}
+
+		TArray<FSuperManagerAssetRowId> GroupedRows;
+		TArray<FSuperManagerRowGroup> Groups;
+
+		SuperManagerNameGroups::GroupRowsByKey<FSuperManagerContentHash>(AssetTable, HashedRows, 2,
+			[&Cache, &AssetTable](const FSuperManagerAssetRowId& Row)
+			{
+				return Cache.FindContentHash(AssetTable.GetPackageName(Row));
+			}, GroupedRows, Groups);
+
+		// Assets of one package hash the same, they are not copies of each other
+		for (const FSuperManagerRowGroup& Group : Groups)
+		{
+			const FName FirstPackageName = AssetTable.GetPackageName(GroupedRows[Group.FirstRow]);
+			bool bSeveralPackages = false;
+
+			for (int32 GroupedIndex = Group.FirstRow + 1; GroupedIndex < Group.FirstRow + Group.NumRows; ++GroupedIndex)
+			{
+				if (AssetTable.GetPackageName(GroupedRows[GroupedIndex]) != FirstPackageName)
+				{
+					bSeveralPackages = true;
+					break;
+				}
+			}
+
+			if (bSeveralPackages)
+			{
+				OutDuplicateRows.Append(GroupedRows.GetData() + Group.FirstRow, Group.NumRows);
+			}
+		}
+	}
+}
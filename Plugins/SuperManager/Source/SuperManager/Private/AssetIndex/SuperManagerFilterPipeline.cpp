@@ -0,0 +1,240 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerFilterPipeline.h"
+
+void FSuperManagerFilterPipeline::SetClassIndex(int32 InClassIndex)
+{
+	if (ClassIndex == InClassIndex) return;
+
+	ClassIndex = InClassIndex;
+	MarkDirty(ESuperManagerFilterStage::Class);
+}
+
+void FSuperManagerFilterPipeline::SetUnusedOnly(bool bInUnusedOnly)
+{
+	if (bUnusedOnly == bInUnusedOnly) return;
+
+	bUnusedOnly = bInUnusedOnly;
+	MarkDirty(ESuperManagerFilterStage::Unused);
+}
+
+void FSuperManagerFilterPipeline::SetMinAgeDays(int32 InMinAgeDays)
+{
+	if (MinAgeDays == InMinAgeDays) return;
+
+	// Package time stamps come from the file system, in UTC
+	MinAgeDays = InMinAgeDays;
+	MaxModifiedTicks = (FDateTime::UtcNow() - FTimespan::FromDays(MinAgeDays)).GetTicks();
+	MarkDirty(ESuperManagerFilterStage::Age);
+}
+
+void FSuperManagerFilterPipeline::SetMinSizeBytes(int64 InMinSizeBytes)
+{
+	if (MinSizeBytes == InMinSizeBytes) return;
+
+	MinSizeBytes = InMinSizeBytes;
+	MarkDirty(ESuperManagerFilterStage::Size);
+}
+
+void FSuperManagerFilterPipeline::SetSameNameOnly(bool bInSameNameOnly)
+{
+	if (bSameNameOnly == bInSameNameOnly) return;
+
+	bSameNameOnly = bInSameNameOnly;
+	MarkDirty(ESuperManagerFilterStage::SameName);
+}
+
+void FSuperManagerFilterPipeline::SetPathWildcard(const FString& InPathWildcard)
+{
+	if (PathWildcard.Equals(InPathWildcard, ESearchCase::IgnoreCase)) return;
+
+	PathWildcard = InPathWildcard;
+	MarkDirty(ESuperManagerFilterStage::Path);
+}
+
+bool FSuperManagerFilterPipeline::IsStageEnabled(ESuperManagerFilterStage Stage) const
+{
+	switch (Stage)
+	{
+	case ESuperManagerFilterStage::Class:		return ClassIndex != INDEX_NONE;
+	case ESuperManagerFilterStage::Unused:		return bUnusedOnly;
+	case ESuperManagerFilterStage::Age:			return MinAgeDays > 0;
+	case ESuperManagerFilterStage::Size:		return MinSizeBytes > 0;
+	case ESuperManagerFilterStage::SameName:	return bSameNameOnly;
+	case ESuperManagerFilterStage::Path:		return !PathWildcard.IsEmpty();
+	default:									return false;
+	}
+}
+
+bool FSuperManagerFilterPipeline::HasEnabledStages() const
+{
+	for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+	{
+		if (IsStageEnabled(static_cast<ESuperManagerFilterStage>(StageIndex))) return true;
+	}
+
+	return false;
+}
+
+void FSuperManagerFilterPipeline::SetSourceRows(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& SourceRows)
+{
+	SourceBits.Init(false, AssetTable.Num());
+
+	for (const FSuperManagerAssetRowId& Row : SourceRows)
+	{
+		SourceBits[Row.Index] = true;
+	}
+
+	FirstDirtyStage = 0;
+	Update(AssetTable);
+}
+
+int32 FSuperManagerFilterPipeline::Update(const FSuperManagerAssetTable& AssetTable)
+{
+	GrowTo(AssetTable.Num());
+
+	const int32 NumEvaluated = NumStages - FirstDirtyStage;
+
+	for (int32 StageIndex = FirstDirtyStage; StageIndex < NumStages; ++StageIndex)
+	{
+		EvaluateStage(AssetTable, StageIndex);
+	}
+
+	FirstDirtyStage = NumStages;
+
+	return NumEvaluated;
+}
+
+void FSuperManagerFilterPipeline::UpdateRows(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& Rows, bool bInSource)
+{
+	GrowTo(AssetTable.Num());
+
+	if (bSameNameOnly)
+	{
+		CountNames(AssetTable);
+	}
+
+	for (const FSuperManagerAssetRowId& Row : Rows)
+	{
+		SourceBits[Row.Index] = bInSource;
+
+		bool bPassed = bInSource;
+
+		for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+		{
+			bPassed = bPassed && PassesStage(AssetTable, StageIndex, Row);
+			StageOutputs[StageIndex][Row.Index] = bPassed;
+		}
+	}
+}
+
+bool FSuperManagerFilterPipeline::Passes(FSuperManagerAssetRowId Row) const
+{
+	const TBitArray<>& PassedRows = StageOutputs[NumStages - 1];
+
+	return PassedRows.IsValidIndex(Row.Index) && PassedRows[Row.Index];
+}
+
+void FSuperManagerFilterPipeline::MarkDirty(ESuperManagerFilterStage Stage)
+{
+	FirstDirtyStage = FMath::Min(FirstDirtyStage, static_cast<int32>(Stage));
+}
+
+void FSuperManagerFilterPipeline::GrowTo(int32 NumRows)
+{
+	if (SourceBits.Num() < NumRows)
+	{
+		SourceBits.Add(false, NumRows - SourceBits.Num());
+	}
+
+	for (TBitArray<>& StageOutput : StageOutputs)
+	{
+		if (StageOutput.Num() < NumRows)
+		{
+			StageOutput.Add(false, NumRows - StageOutput.Num());
+		}
+	}
+}
+
+void FSuperManagerFilterPipeline::EvaluateStage(const FSuperManagerAssetTable& AssetTable, int32 StageIndex)
+{
+	const TBitArray<>& StageInput = GetStageInput(StageIndex);
+	TBitArray<>& StageOutput = StageOutputs[StageIndex];
+
+	if (!IsStageEnabled(static_cast<ESuperManagerFilterStage>(StageIndex)))
+	{
+		StageOutput = StageInput;
+		return;
+	}
+
+	if (StageIndex == static_cast<int32>(ESuperManagerFilterStage::SameName))
+	{
+		CountNames(AssetTable);
+	}
+
+	StageOutput.Init(false, StageInput.Num());
+
+	for (TConstSetBitIterator<> It(StageInput); It; ++It)
+	{
+		const FSuperManagerAssetRowId Row(It.GetIndex());
+
+		if (PassesStage(AssetTable, StageIndex, Row))
+		{
+			StageOutput[Row.Index] = true;
+		}
+	}
+}
+
+bool FSuperManagerFilterPipeline::PassesStage(const FSuperManagerAssetTable& AssetTable, int32 StageIndex,
+	FSuperManagerAssetRowId Row) const
+{
+	const ESuperManagerFilterStage Stage = static_cast<ESuperManagerFilterStage>(StageIndex);
+	if (!IsStageEnabled(Stage)) return true;
+
+	switch (Stage)
+	{
+	case ESuperManagerFilterStage::Class:
+		return AssetTable.GetClassIndex(Row) == ClassIndex;
+
+	// Kept up to date from the reference index, same answer as IsPackageUnused
+	case ESuperManagerFilterStage::Unused:
+		return AssetTable.GetReferencerCount(Row) == 0;
+
+	case ESuperManagerFilterStage::Age:
+	{
+		const int64 ModifiedTicks = AssetTable.GetModifiedTicks(Row);
+		return ModifiedTicks > 0 && ModifiedTicks <= MaxModifiedTicks;
+	}
+
+	case ESuperManagerFilterStage::Size:
+		return AssetTable.HasSize(Row) && AssetTable.GetSize(Row).DiskBytes >= MinSizeBytes;
+
+	case ESuperManagerFilterStage::SameName:
+		return NameCounts.FindRef(AssetTable.GetAssetName(Row)) > 1;
+
+	case ESuperManagerFilterStage::Path:
+		return AssetTable.GetPackageName(Row).ToString().MatchesWildcard(PathWildcard);
+
+	default:
+		return true;
+	}
+}
+
+void FSuperManagerFilterPipeline::CountNames(const FSuperManagerAssetTable& AssetTable)
+{
+	if (!bNameCountsDirty) return;
+
+	bNameCountsDirty = false;
+	NameCounts.Reset();
+
+	for (int32 RowIndex = 0; RowIndex < AssetTable.Num(); ++RowIndex)
+	{
+		const FSuperManagerAssetRowId Row(RowIndex);
+		if (AssetTable.HasFlags(Row, ESuperManagerAssetRowFlags::Deleted)) continue;
+
+		++NameCounts.FindOrAdd(AssetTable.GetAssetName(Row));
+	}
+}
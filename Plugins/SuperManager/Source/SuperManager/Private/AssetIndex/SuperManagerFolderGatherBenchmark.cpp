@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include "AssetIndex/SuperManagerNameSearch.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EditorAssetLibrary.h"
+#include "SuperManager.h"
+
+/**
+ * SuperManager.BenchmarkFolderGather [PackagePath]
+ * Times what opening the Advanced Deletion tab on PackagePath (default /Game) costs :
+ * the old ListAssets + DoesAssetExist + FindAssetData gathering, the single FARFilter query that replaced it,
+ * and the whole tab open (query, asset table, name search index).
+ * Then times the table and search index part of the tab open on synthetic folders of 10k, 100k and 500k assets,
+ * so the three sizes are measured in one run whatever the size of the project.
+ */
+namespace SuperManagerFolderGatherBenchmark
+{
+	static const int32 SyntheticFolderSizes[] = { 10000, 100000, 500000 };
+
+	static void LogResult(const FSuperManagerBenchmark& Benchmark, const TCHAR* PassName, int32 NumAssets, double Seconds)
+	{
+		Benchmark.LogResult(PassName, FString::Printf(TEXT("%d assets, %.1f ms, %.2f us/asset"),
+			NumAssets, Seconds * 1000.0, Seconds * 1e6 / FMath::Max(NumAssets, 1)));
+	}
+
+	/** What the tab builds from the gathered registry data : the asset table with its index columns, and the search index */
+	static int32 BuildTabData(const TArray<FAssetData>& AssetsData, const FSuperManagerReferenceIndex& Index)
+	{
+		FSuperManagerAssetTable AssetTable;
+		AssetTable.Reserve(AssetsData.Num());
+
+		for (const FAssetData& Data : AssetsData)
+		{
+			const FSuperManagerAssetRowId Row = AssetTable.AddAsset(Data);
+			AssetTable.SetReferencerCount(Row, Index.GetReferencerCount(Data.PackageName));
+			AssetTable.SetModifiedTicks(Row, Index.GetPackageTimeStamp(Data.PackageName));
+		}
+
+		FSuperManagerNameSearch NameSearch;
+		NameSearch.Build(AssetTable);
+
+		return AssetTable.Num();
+	}
+
+	static void RunSyntheticFolders(const FSuperManagerBenchmark& Benchmark, const FSuperManagerReferenceIndex& Index)
+	{
+		static const TCHAR* AssetKinds[] = { TEXT("SM_Rock"), TEXT("T_Rock"), TEXT("M_Ground"), TEXT("BP_Door"), TEXT("S_Step") };
+
+		const FTopLevelAssetPath ClassPath(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+
+		for (const int32 FolderSize : SyntheticFolderSizes)
+		{
+			// Registry results are generated outside the timing, 100 assets per sub folder
+			TArray<FAssetData> AssetsData;
+			AssetsData.Reserve(FolderSize);
+
+			for (int32 AssetIndex = 0; AssetIndex < FolderSize; ++AssetIndex)
+			{
+				const FName PackagePath(*FString::Printf(TEXT("/Game/Benchmark/Folder_%d"), AssetIndex / 100));
+				const FName AssetName(*FString::Printf(TEXT("%s_%d"), AssetKinds[AssetIndex % UE_ARRAY_COUNT(AssetKinds)], AssetIndex));
+
+				AssetsData.Emplace(FName(*(PackagePath.ToString() / AssetName.ToString())), PackagePath, AssetName, ClassPath);
+			}
+
+			int32 NumAssets = 0;
+
+			const double Seconds = FSuperManagerBenchmark::TimePass([&AssetsData, &Index]()
+			{
+				return BuildTabData(AssetsData, Index);
+			}, NumAssets);
+
+			LogResult(Benchmark, *FString::Printf(TEXT("tab open, %dk synthetic (table, search)"), FolderSize / 1000), NumAssets, Seconds);
+		}
+	}
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		const FString FolderPath = FSuperManagerBenchmark::GetPackagePathArgument(Args);
+
+		FSuperManagerModule& SuperManagerModule =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+		const FSuperManagerPathExclusion& Exclusion = SuperManagerModule.GetPathExclusion();
+
+		// Built outside the timings, every pass reads referencer counts from it
+		const FSuperManagerReferenceIndex& Index = SuperManagerModule.GetReferenceIndex();
+
+		int32 NumAssets = 0;
+
+		double Seconds = FSuperManagerBenchmark::TimePass([&FolderPath, &Exclusion]()
+		{
+			TArray<FAssetData> AssetsData;
+
+			for (const FString& AssetPathName : UEditorAssetLibrary::ListAssets(FolderPath))
+			{
+				if (!UEditorAssetLibrary::DoesAssetExist(AssetPathName)) continue;
+
+				const FAssetData Data = UEditorAssetLibrary::FindAssetData(AssetPathName);
+				if (Exclusion.IsPackagePathExcluded(Data.PackagePath)) continue;
+
+				AssetsData.Add(Data);
+			}
+
+			return AssetsData.Num();
+		}, NumAssets);
+		LogResult(Benchmark, TEXT("ListAssets + lookups (old)"), NumAssets, Seconds);
+
+		if (NumAssets > 0)
+		{
+			Seconds = FSuperManagerBenchmark::TimePass([&FolderPath, &SuperManagerModule]()
+			{
+				TArray<FAssetData> AssetsData;
+				SuperManagerModule.GatherAssetsUnderFolders({ FolderPath }, AssetsData);
+
+				return AssetsData.Num();
+			}, NumAssets);
+			LogResult(Benchmark, TEXT("FARFilter query"), NumAssets, Seconds);
+
+			Seconds = FSuperManagerBenchmark::TimePass([&FolderPath, &SuperManagerModule]()
+			{
+				const TSharedRef<FSuperManagerAssetTable> AssetTable = SuperManagerModule.BuildAssetTableUnderFolders({ FolderPath });
+
+				FSuperManagerNameSearch NameSearch;
+				NameSearch.Build(*AssetTable);
+
+				return AssetTable->Num();
+			}, NumAssets);
+			LogResult(Benchmark, TEXT("tab open (query, table, search)"), NumAssets, Seconds);
+		}
+		else
+		{
+			Benchmark.LogMessage(TEXT("no assets under ") + FolderPath);
+		}
+
+		RunSyntheticFolders(Benchmark, Index);
+	}
+
+	static FSuperManagerBenchmark BenchmarkFolderGather(
+		TEXT("SuperManager.BenchmarkFolderGather"),
+		TEXT("Measure the Advanced Deletion tab open time against the old per path gathering, and at 10k, 100k and 500k assets. Optional argument : package path"),
+		&Run);
+}
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerFolderTree.h"
+#include "AssetIndex/SuperManagerPathExclusion.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+namespace SuperManagerFolderTree
+{
+	struct FFolderNode
+	{
+		int32 ParentIndex = INDEX_NONE;
+		int32 Depth = 0;
+
+		// Assets directly in the folder, then assets of the whole subtree after propagation
+		int32 NumAssets = 0;
+	};
+
+	void CollapseNestedFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutRootPaths)
+	{
+		// With the slash kept, a folder sorts right before its sub folders and "/Game/A-B/" cannot land between them
+		TArray<FString> SortedPaths;
+		SortedPaths.Reserve(FolderPaths.Num());
+
+		for (FString FolderPath : FolderPaths)
+		{
+			FolderPath.RemoveFromEnd(TEXT("/"));
+			SortedPaths.Add(FolderPath + TEXT("/"));
+		}
+
+		SortedPaths.Sort();
+
+		OutRootPaths.Reset();
+
+		for (const FString& SortedPath : SortedPaths)
+		{
+			if (OutRootPaths.Num() > 0 && SortedPath.StartsWith(OutRootPaths.Last() + TEXT("/"))) continue;
+
+			OutRootPaths.Add(SortedPath.LeftChop(1));
+		}
+	}
+
+	void FindEmptyFolderRoots(const FString& FolderPath, const FSuperManagerPathExclusion& Exclusion,
+		TArray<FString>& OutEmptyFolderPaths)
+	{
+		const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		FString RootPath = FolderPath;
+		RootPath.RemoveFromEnd(TEXT("/"));
+
+		// Index 0 is the selected folder itself, never reported
+		TArray<FString> FolderPaths;
+		FolderPaths.Add(RootPath);
+
+		TArray<FString> SubPaths;
+		AssetRegistry.GetSubPaths(RootPath, SubPaths, true);
+		FolderPaths.Append(MoveTemp(SubPaths));
+
+		TArray<FFolderNode> FolderNodes;
+		FolderNodes.SetNum(FolderPaths.Num());
+
+		TMap<FName, int32> FolderIndices;
+		FolderIndices.Reserve(FolderPaths.Num());
+
+		for (int32 FolderIndex = 0; FolderIndex < FolderPaths.Num(); ++FolderIndex)
+		{
+			FolderIndices.Add(FName(*FolderPaths[FolderIndex]), FolderIndex);
+		}
+
+		for (int32 FolderIndex = 1; FolderIndex < FolderPaths.Num(); ++FolderIndex)
+		{
+			FFolderNode& FolderNode = FolderNodes[FolderIndex];
+
+			const int32* ParentIndex = FolderIndices.Find(FName(*FPaths::GetPath(FolderPaths[FolderIndex])));
+			FolderNode.ParentIndex = ParentIndex ? *ParentIndex : 0;
+
+			for (const TCHAR Character : FolderPaths[FolderIndex])
+			{
+				FolderNode.Depth += Character == TEXT('/') ? 1 : 0;
+			}
+
+			// Deleting the parent of an excluded folder would delete it too
+			if (Exclusion.IsPathExcluded(FolderPaths[FolderIndex]))
+			{
+				++FolderNode.NumAssets;
+			}
+		}
+
+		// One pass over the registry instead of one subtree walk per folder
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Emplace(*RootPath);
+
+		AssetRegistry.EnumerateAssets(Filter, [&FolderIndices, &FolderNodes](const FAssetData& AssetData)
+		{
+			if (const int32* FolderIndex = FolderIndices.Find(AssetData.PackagePath))
+			{
+				++FolderNodes[*FolderIndex].NumAssets;
+			}
+			return true;
+		});
+
+		// Deepest first, so every child is counted before its parent
+		TArray<int32> FolderOrder;
+		FolderOrder.Reserve(FolderPaths.Num() - 1);
+
+		for (int32 FolderIndex = 1; FolderIndex < FolderPaths.Num(); ++FolderIndex)
+		{
+			FolderOrder.Add(FolderIndex);
+		}
+
+		FolderOrder.Sort([&FolderNodes](int32 A, int32 B)
+		{
+			return FolderNodes[A].Depth > FolderNodes[B].Depth;
+		});
+
+		for (const int32 FolderIndex : FolderOrder)
+		{
+			FolderNodes[FolderNodes[FolderIndex].ParentIndex].NumAssets += FolderNodes[FolderIndex].NumAssets;
+		}
+
+		// Empty with a parent that is not, or directly under the selected folder
+		for (int32 FolderIndex = 1; FolderIndex < FolderPaths.Num(); ++FolderIndex)
+		{
+			const FFolderNode& FolderNode = FolderNodes[FolderIndex];
+			if (FolderNode.NumAssets > 0) continue;
+
+			if (FolderNode.ParentIndex == 0 || FolderNodes[FolderNode.ParentIndex].NumAssets > 0)
+			{
+				OutEmptyFolderPaths.Add(FolderPaths[FolderIndex]);
+			}
+		}
+
+		OutEmptyFolderPaths.Sort();
+	}
+
+	int32 DeleteFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutFailedFolderPaths)
+	{
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		// Nested or repeated inputs would list their sub folders, and report their failures, more than once
+		TArray<FString> RootPaths;
+		CollapseNestedFolders(FolderPaths, RootPaths);
+
+		TArray<FString> FoldersToDelete;
+
+		for (const FString& RootPath : RootPaths)
+		{
+			FoldersToDelete.Add(RootPath);
+			AssetRegistry.GetSubPaths(RootPath, FoldersToDelete, true);
+		}
+
+		// Longest path first, every child goes before its parent
+		FoldersToDelete.Sort([](const FString& A, const FString& B)
+		{
+			return A.Len() > B.Len();
+		});
+
+		TSet<FString> DeletedFolders;
+		DeletedFolders.Reserve(FoldersToDelete.Num());
+
+		IFileManager& FileManager = IFileManager::Get();
+
+		for (const FString& FolderPath : FoldersToDelete)
+		{
+			if (DeletedFolders.Contains(FolderPath)) continue;
+
+			FString FolderFilename;
+			if (!FPackageName::TryConvertLongPackageNameToFilename(FolderPath + TEXT("/"), FolderFilename))
+			{
+				OutFailedFolderPaths.Add(FolderPath);
+				continue;
+			}
+
+			// Not a tree delete, a folder that still has files on disk fails instead of losing them
+			if (FileManager.DeleteDirectory(*FolderFilename, false, false))
+			{
+				DeletedFolders.Add(FolderPath);
+			}
+			else
+			{
+				OutFailedFolderPaths.Add(FolderPath);
+			}
+		}
+
+		// One removal per deleted subtree, RemovePath drops the sub paths with it
+		for (const FString& DeletedFolder : DeletedFolders)
+		{
+			if (!DeletedFolders.Contains(FPaths::GetPath(DeletedFolder)))
+			{
+				AssetRegistry.RemovePath(DeletedFolder);
+			}
+		}
+
+		OutFailedFolderPaths.Sort();
+
+		return DeletedFolders.Num();
+	}
+}
@@ -0,0 +1,17 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerNameGroups.h"
+
+namespace SuperManagerNameGroups
+{
+	void GroupRowsByName(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		int32 MinGroupSize, TArray<FSuperManagerAssetRowId>& OutGroupedRows, TArray<FSuperManagerRowGroup>& OutGroups)
+	{
+		GroupRowsByKey<FName>(AssetTable, Rows, MinGroupSize,
+			[&AssetTable](const FSuperManagerAssetRowId& Row)
+			{
+				return AssetTable.GetAssetName(Row);
+			}, OutGroupedRows, OutGroups);
+	}
+}
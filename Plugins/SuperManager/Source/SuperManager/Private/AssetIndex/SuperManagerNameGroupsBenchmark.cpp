@@ -0,0 +1,121 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerNameGroups.h"
+
+/**
+ * SuperManager.BenchmarkSameName [NumAssets]
+ * Builds a synthetic asset table of NumAssets rows (default 500000) and times same-name detection at
+ * several name collision rates : the old FString multimap + MultiFind + AddUnique pass, and the single
+ * FName grouping pass. The old pass is quadratic in the number of duplicated rows, it only runs on the
+ * first OldPassMaxRows rows, which have the same collision rate as the whole table.
+ */
+namespace SuperManagerNameGroupsBenchmark
+{
+	static const int32 OldPassMaxRows = 20000;
+
+	// Rows per distinct name
+	static const int32 RowsPerNameCases[] = { 1, 2, 8, 1000 };
+
+	// From this many rows per name the old pass takes billions of comparisons, it is timed once
+	static const int32 SingleOldPassRowsPerName = 1000;
+
+	static void LogResult(const FSuperManagerBenchmark& Benchmark, const TCHAR* PassName, int32 RowsPerName, int32 NumRows,
+		double Seconds, int32 NumSameNameRows)
+	{
+		Benchmark.LogResult(PassName, FString::Printf(TEXT("%4d rows/name, %d rows, %.1f ms, %d same name rows"),
+			RowsPerName, NumRows, Seconds * 1000.0, NumSameNameRows));
+	}
+
+	static int32 RunOldPass(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows)
+	{
+		TMultiMap<FString, FSuperManagerAssetRowId> RowsByName;
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			RowsByName.Add(AssetTable.GetAssetName(Row).ToString(), Row);
+		}
+
+		TArray<FSuperManagerAssetRowId> SameNameRows;
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			TArray<FSuperManagerAssetRowId> FoundRows;
+			RowsByName.MultiFind(AssetTable.GetAssetName(Row).ToString(), FoundRows);
+
+			if (FoundRows.Num() <= 1) continue;
+
+			for (const FSuperManagerAssetRowId& FoundRow : FoundRows)
+			{
+				SameNameRows.AddUnique(FoundRow);
+			}
+		}
+
+		return SameNameRows.Num();
+	}
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		const int32 NumAssets = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500000;
+
+		const FTopLevelAssetPath ClassPath(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+
+		for (const int32 RowsPerName : RowsPerNameCases)
+		{
+			FSuperManagerAssetTable AssetTable;
+			AssetTable.Reserve(NumAssets);
+
+			// Consecutive rows share a name, so any leading slice of the table, the old pass rows included,
+			// has RowsPerName rows per name. Each of them is in its own folder, like assets copied into every feature folder
+			for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+			{
+				const FName AssetName(*FString::Printf(TEXT("SM_Benchmark_%d"), AssetIndex / RowsPerName));
+				const FName PackagePath(*FString::Printf(TEXT("/Game/Benchmark/Folder_%d"), AssetIndex % RowsPerName));
+
+				AssetTable.AddAsset(FAssetData(
+					FName(*(PackagePath.ToString() / AssetName.ToString())), PackagePath, AssetName, ClassPath));
+			}
+
+			TArray<FSuperManagerAssetRowId> AllRows;
+			AssetTable.GetAllRows(AllRows);
+
+			TArray<FSuperManagerAssetRowId> OldPassRows(AllRows.GetData(), FMath::Min(AllRows.Num(), OldPassMaxRows));
+
+			int32 NumSameNameRows = 0;
+
+			const int32 OldPassIterations = RowsPerName >= SingleOldPassRowsPerName ? 1 : FSuperManagerBenchmark::DefaultNumIterations;
+
+			double Seconds = FSuperManagerBenchmark::TimePass([&AssetTable, &OldPassRows]()
+			{
+				return RunOldPass(AssetTable, OldPassRows);
+			}, NumSameNameRows, OldPassIterations);
+			LogResult(Benchmark, TEXT("FString multimap (old)"), RowsPerName, OldPassRows.Num(), Seconds, NumSameNameRows);
+
+			Seconds = FSuperManagerBenchmark::TimePass([&AssetTable, &OldPassRows]()
+			{
+				TArray<FSuperManagerAssetRowId> GroupedRows;
+				TArray<FSuperManagerRowGroup> Groups;
+				SuperManagerNameGroups::GroupRowsByName(AssetTable, OldPassRows, 2, GroupedRows, Groups);
+
+				return GroupedRows.Num();
+			}, NumSameNameRows);
+			LogResult(Benchmark, TEXT("FName grouping"), RowsPerName, OldPassRows.Num(), Seconds, NumSameNameRows);
+
+			Seconds = FSuperManagerBenchmark::TimePass([&AssetTable, &AllRows]()
+			{
+				TArray<FSuperManagerAssetRowId> GroupedRows;
+				TArray<FSuperManagerRowGroup> Groups;
+				SuperManagerNameGroups::GroupRowsByName(AssetTable, AllRows, 2, GroupedRows, Groups);
+
+				return GroupedRows.Num();
+			}, NumSameNameRows);
+			LogResult(Benchmark, TEXT("FName grouping"), RowsPerName, AllRows.Num(), Seconds, NumSameNameRows);
+		}
+	}
+
+	static FSuperManagerBenchmark BenchmarkSameName(
+		TEXT("SuperManager.BenchmarkSameName"),
+		TEXT("Measure same-name detection on a synthetic asset table against the old string multimap. Optional argument : number of assets"),
+		&Run);
+}
@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerNameSearch.h"
+#include "Algo/BinarySearch.h"
+
+void FSuperManagerNameSearch::Build(const FSuperManagerAssetTable& AssetTable)
+{
+	Reset();
+
+	TextOffsets.Reserve(AssetTable.Num());
+
+	for (int32 RowIndex = 0; RowIndex < AssetTable.Num(); ++RowIndex)
+	{
+		AddRow(AssetTable, FSuperManagerAssetRowId(RowIndex));
+	}
+
+	for (TArray<int32>& Posting : Postings)
+	{
+		Posting.Shrink();
+	}
+}
+
+void FSuperManagerNameSearch::AddRow(const FSuperManagerAssetTable& AssetTable, FSuperManagerAssetRowId Row)
+{
+	check(Row.Index == Num());
+
+	const FString LowerPath = AssetTable.GetObjectPath(Row).ToString().ToLower();
+	const FTCHARToUTF8 Utf8Path(*LowerPath);
+
+	TextOffsets.Add(TextBuffer.Num());
+	TextBuffer.Append(reinterpret_cast<const ANSICHAR*>(Utf8Path.Get()), Utf8Path.Length());
+	TextBuffer.Add('\0');
+
+	for (int32 CharIndex = 0; CharIndex + 3 <= Utf8Path.Length(); ++CharIndex)
+	{
+		const uint32 Trigram = MakeTrigram(reinterpret_cast<const ANSICHAR*>(Utf8Path.Get()) + CharIndex);
+
+		int32& PostingIndex = PostingIndexByTrigram.FindOrAdd(Trigram, INDEX_NONE);
+		if (PostingIndex == INDEX_NONE)
+		{
+			PostingIndex = Postings.AddDefaulted();
+		}
+
+		// Rows are added in order, a repeated trigram in the same path is the last entry
+		TArray<int32>& Posting = Postings[PostingIndex];
+		if (Posting.Num() == 0 || Posting.Last() != Row.Index)
+		{
+			Posting.Add(Row.Index);
+		}
+	}
+}
+
+bool FSuperManagerNameSearch::Matches(FSuperManagerAssetRowId Row, const FString& Query) const
+{
+	const FTCHARToUTF8 Utf8Query(*Query.ToLower());
+
+	return RowContains(Row.Index, reinterpret_cast<const ANSICHAR*>(Utf8Query.Get()));
+}
+
+void FSuperManagerNameSearch::Reset()
+{
+	TextBuffer.Empty();
+	TextOffsets.Empty();
+	PostingIndexByTrigram.Empty();
+	Postings.Empty();
+}
+
+bool FSuperManagerNameSearch::RowContains(int32 RowIndex, const ANSICHAR* LowerQuery) const
+{
+	return FCStringAnsi::Strstr(GetText(RowIndex), LowerQuery) != nullptr;
+}
+
+void FSuperManagerNameSearch::Search(const FString& Query, const TArray<FSuperManagerAssetRowId>* Candidates,
+	TArray<FSuperManagerAssetRowId>& OutRows) const
+{
+	OutRows.Reset();
+
+	const FTCHARToUTF8 Utf8Query(*Query.ToLower());
+	const ANSICHAR* LowerQuery = reinterpret_cast<const ANSICHAR*>(Utf8Query.Get());
+	const int32 QueryLength = Utf8Query.Length();
+
+	if (QueryLength < 3)
+	{
+		// Too short for a trigram, every candidate is checked
+		if (Candidates)
+		{
+			for (const FSuperManagerAssetRowId& Row : *Candidates)
+			{
+				if (QueryLength == 0 || RowContains(Row.Index, LowerQuery))
+				{
+					OutRows.Add(Row);
+				}
+			}
+		}
+		else
+		{
+			for (int32 RowIndex = 0; RowIndex < Num(); ++RowIndex)
+			{
+				if (QueryLength == 0 || RowContains(RowIndex, LowerQuery))
+				{
+					OutRows.Add(FSuperManagerAssetRowId(RowIndex));
+				}
+			}
+		}
+
+		return;
+	}
+
+	TArray<const TArray<int32>*, TInlineAllocator<32>> QueryPostings;
+
+	for (int32 CharIndex = 0; CharIndex + 3 <= QueryLength; ++CharIndex)
+	{
+		const int32* PostingIndex = PostingIndexByTrigram.Find(MakeTrigram(LowerQuery + CharIndex));
+
+		// A trigram no path has, nothing can match
+		if (!PostingIndex) return;
+
+		QueryPostings.AddUnique(&Postings[*PostingIndex]);
+	}
+
+	QueryPostings.Sort([](const TArray<int32>& A, const TArray<int32>& B)
+	{
+		return A.Num() < B.Num();
+	});
+
+	auto PassesPostings = [&QueryPostings](int32 RowIndex, int32 FirstPosting)
+	{
+		for (int32 PostingIndex = FirstPosting; PostingIndex < QueryPostings.Num(); ++PostingIndex)
+		{
+			if (Algo::BinarySearch(*QueryPostings[PostingIndex], RowIndex) == INDEX_NONE) return false;
+		}
+
+		return true;
+	};
+
+	// Walk whichever is shorter, the previous matches or the rarest trigram's rows
+	if (Candidates && Candidates->Num() <= QueryPostings[0]->Num())
+	{
+		for (const FSuperManagerAssetRowId& Row : *Candidates)
+		{
+			if (PassesPostings(Row.Index, 0) && RowContains(Row.Index, LowerQuery))
+			{
+				OutRows.Add(Row);
+			}
+		}
+	}
+	else
+	{
+		for (const int32 RowIndex : *QueryPostings[0])
+		{
+			if (Candidates && Algo::BinarySearchBy(*Candidates, RowIndex, &FSuperManagerAssetRowId::Index) == INDEX_NONE) continue;
+
+			// Sharing every trigram does not mean they are in sequence
+			if (PassesPostings(RowIndex, 1) && RowContains(RowIndex, LowerQuery))
+			{
+				OutRows.Add(FSuperManagerAssetRowId(RowIndex));
+			}
+		}
+	}
+}
+
+SIZE_T FSuperManagerNameSearch::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = TextBuffer.GetAllocatedSize() + TextOffsets.GetAllocatedSize()
+		+ PostingIndexByTrigram.GetAllocatedSize() + Postings.GetAllocatedSize();
+
+	for (const TArray<int32>& Posting : Postings)
+	{
+		AllocatedSize += Posting.GetAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
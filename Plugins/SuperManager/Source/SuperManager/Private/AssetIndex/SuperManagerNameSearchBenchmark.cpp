@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerNameSearch.h"
+
+/**
+ * SuperManager.BenchmarkNameSearch [NumAssets]
+ * Builds a synthetic asset table of NumAssets rows (default 200000), times building the name search index,
+ * then types a query one character at a time the way the Advanced Deletion tab does, every keystroke
+ * narrowing the previous matches. The slowest keystroke is what has to stay under a 16 ms frame.
+ */
+namespace SuperManagerNameSearchBenchmark
+{
+	static const TCHAR* TypedQuery = TEXT("folder_12/sm_rock_12");
+
+	// Frame budget of one keystroke, search to redraw
+	static const double KeystrokeBudgetSeconds = 0.016;
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		const int32 NumAssets = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 200000;
+
+		static const TCHAR* AssetKinds[] = { TEXT("SM_Rock"), TEXT("T_Rock"), TEXT("M_Ground"), TEXT("BP_Door"), TEXT("S_Step") };
+
+		const FTopLevelAssetPath ClassPath(TEXT("/Script/Engine"), TEXT("StaticMesh"));
+
+		FSuperManagerAssetTable AssetTable;
+		AssetTable.Reserve(NumAssets);
+
+		for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+		{
+			const FName PackagePath(*FString::Printf(TEXT("/Game/Benchmark/Folder_%d"), AssetIndex / 100));
+			const FName AssetName(*FString::Printf(TEXT("%s_%d"), AssetKinds[AssetIndex % UE_ARRAY_COUNT(AssetKinds)], AssetIndex));
+
+			AssetTable.AddAsset(FAssetData(
+				FName(*(PackagePath.ToString() / AssetName.ToString())), PackagePath, AssetName, ClassPath));
+		}
+
+		FSuperManagerNameSearch NameSearch;
+		int32 NumIndexedRows = 0;
+
+		const double BuildSeconds = FSuperManagerBenchmark::TimePass([&AssetTable, &NameSearch]()
+		{
+			NameSearch.Build(AssetTable);
+			return NameSearch.Num();
+		}, NumIndexedRows);
+
+		Benchmark.LogResult(TEXT("build index"), FString::Printf(TEXT("%d rows, %.1f ms, %s"),
+			NumIndexedRows, BuildSeconds * 1000.0, *FText::AsMemory(NameSearch.GetAllocatedSize()).ToString()));
+
+		// Every keystroke narrows the matches of the one before, like SAdvanceDeletionTab::OnSearchTextChanged
+		const FString Query(TypedQuery);
+
+		double WorstSeconds = 0.0;
+		double TotalSeconds = 0.0;
+		int32 NumMatches = 0;
+
+		TArray<FSuperManagerAssetRowId> PreviousMatches;
+		TArray<FSuperManagerAssetRowId> Matches;
+
+		for (int32 QueryLength = 1; QueryLength <= Query.Len(); ++QueryLength)
+		{
+			const FString TypedText = Query.Left(QueryLength);
+
+			const double KeystrokeSeconds = FSuperManagerBenchmark::TimePass([&]()
+			{
+				Matches.Reset();
+				NameSearch.Search(TypedText, QueryLength > 1 ? &PreviousMatches : nullptr, Matches);
+
+				return Matches.Num();
+			}, NumMatches);
+
+			WorstSeconds = FMath::Max(WorstSeconds, KeystrokeSeconds);
+			TotalSeconds += KeystrokeSeconds;
+
+			PreviousMatches = Matches;
+		}
+
+		Benchmark.LogResult(TEXT("typing, per keystroke"), FString::Printf(
+			TEXT("%d rows, %d keystrokes, %.2f ms mean, %.2f ms worst (%s the 16 ms budget), %d final matches"),
+			NumIndexedRows, Query.Len(), TotalSeconds * 1000.0 / Query.Len(), WorstSeconds * 1000.0,
+			WorstSeconds <= KeystrokeBudgetSeconds ? TEXT("within") : TEXT("over"), NumMatches));
+	}
+
+	static FSuperManagerBenchmark BenchmarkNameSearch(
+		TEXT("SuperManager.BenchmarkNameSearch"),
+		TEXT("Measure the name search index build and the per keystroke search time on a synthetic asset table. Optional argument : number of assets"),
+		&Run);
+}
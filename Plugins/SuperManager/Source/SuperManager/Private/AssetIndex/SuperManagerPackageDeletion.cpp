@@ -0,0 +1,238 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerPackageDeletion.h"
+#include "AssetIndex/SuperManagerReferenceIndex.h"
+#include "AssetIndex/SuperManagerPackageSizes.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "ISourceControlModule.h"
+#include "FileHelpers.h"
+#include "HAL/PlatformFileManager.h"
+#include "Serialization/ArchiveUObject.h"
+#include "UObject/UObjectHash.h"
+
+namespace SuperManagerPackageDeletion
+{
+	// Deleted files are reported to the registry this many at a time
+	static const int32 RegistryNotifyBatchSize = 1024;
+
+	/**
+	 * Which of the candidate packages an object points at, through object pointers and soft object paths.
+	 * A reference query like FFindReferencersArchive : neither saving nor persistent, so no save-only code runs
+	 */
+	class FPackageReferenceCollector : public FArchiveUObject
+	{
+	public:
+		FPackageReferenceCollector(const TSet<FName>& InCandidatePackages, TSet<FName>& InReferencedPackages)
+			: CandidatePackages(InCandidatePackages)
+			, ReferencedPackages(InReferencedPackages)
+		{
+			ArIsObjectReferenceCollector = true;
+			ArShouldSkipBulkData = true;
+		}
+
+		bool HasReferencedEveryCandidate() const { return ReferencedPackages.Num() == CandidatePackages.Num(); }
+
+		using FArchiveUObject::operator<<;
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			if (Object)
+			{
+				MarkReferenced(Object->GetPackage()->GetFName());
+			}
+
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FSoftObjectPath& Value) override
+		{
+			MarkReferenced(Value.GetLongPackageFName());
+			return *this;
+		}
+
+	private:
+		void MarkReferenced(FName PackageName)
+		{
+			if (CandidatePackages.Contains(PackageName))
+			{
+				ReferencedPackages.Add(PackageName);
+			}
+		}
+
+		const TSet<FName>& CandidatePackages;
+		TSet<FName>& ReferencedPackages;
+	};
+
+	/** Every file can be removed : present, not read only and not held open by another process */
+	static bool CanDeleteFiles(const TArray<FString>& Filenames)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		for (const FString& Filename : Filenames)
+		{
+			if (!PlatformFile.FileExists(*Filename) || PlatformFile.IsReadOnly(*Filename)) return false;
+
+			// Opened for append and closed right away, nothing is written
+			TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*Filename, true, false));
+			if (!FileHandle.IsValid()) return false;
+		}
+
+		return true;
+	}
+
+	// Unsaved edits are not in the registry yet, so the objects of dirty packages are searched in memory
+	static void GatherPackagesReferencedInMemory(const TSet<FName>& CandidatePackages, TSet<FName>& OutReferencedPackages)
+	{
+		if (CandidatePackages.Num() == 0) return;
+
+		TArray<UPackage*> DirtyPackages;
+		FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+		FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+
+		FPackageReferenceCollector Collector(CandidatePackages, OutReferencedPackages);
+		TArray<UObject*> PackageObjects;
+
+		for (UPackage* DirtyPackage : DirtyPackages)
+		{
+			PackageObjects.Reset();
+			GetObjectsWithPackage(DirtyPackage, PackageObjects, true);
+
+			for (UObject* Object : PackageObjects)
+			{
+				Object->Serialize(Collector);
+
+				// Nothing left to find
+				if (Collector.HasReferencedEveryCandidate()) return;
+			}
+		}
+	}
+
+	void PartitionAssets(const TArray<FAssetData>& AssetsToDelete, const FSuperManagerReferenceIndex& ReferenceIndex,
+		TArray<FName>& OutFastPathPackages, TArray<FAssetData>& OutFallbackAssets)
+	{
+		const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		// Files under source control have to be marked for delete, ObjectTools knows how to do that.
+		// While the registry is still scanning, a package with no referencer found may just have none found yet
+		if (ISourceControlModule::Get().IsEnabled() || AssetRegistry.IsLoadingAssets())
+		{
+			OutFallbackAssets.Append(AssetsToDelete);
+			return;
+		}
+
+		TMap<FName, TArray<const FAssetData*>> AssetsByPackage;
+
+		for (const FAssetData& AssetData : AssetsToDelete)
+		{
+			AssetsByPackage.FindOrAdd(AssetData.PackageName).Add(&AssetData);
+		}
+
+		// Registry checks first, only the packages passing them are searched for in memory
+		TSet<FName> CandidatePackages;
+		TArray<FAssetData> PackageAssets;
+
+		for (const TPair<FName, TArray<const FAssetData*>>& PackageEntry : AssetsByPackage)
+		{
+			PackageAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(PackageEntry.Key, PackageAssets, true);
+
+			// Index edges are the registry package dependencies, soft references included
+			const bool bCanDeleteFile =
+				ReferenceIndex.IsPackageUnused(PackageEntry.Key) &&
+				FindObjectFast<UPackage>(nullptr, PackageEntry.Key) == nullptr &&
+				PackageAssets.Num() == PackageEntry.Value.Num();
+
+			if (bCanDeleteFile)
+			{
+				CandidatePackages.Add(PackageEntry.Key);
+			}
+		}
+
+		TSet<FName> PackagesReferencedInMemory;
+		GatherPackagesReferencedInMemory(CandidatePackages, PackagesReferencedInMemory);
+
+		for (const TPair<FName, TArray<const FAssetData*>>& PackageEntry : AssetsByPackage)
+		{
+			if (CandidatePackages.Contains(PackageEntry.Key) && !PackagesReferencedInMemory.Contains(PackageEntry.Key))
+			{
+				OutFastPathPackages.Add(PackageEntry.Key);
+				continue;
+			}
+
+			for (const FAssetData* AssetData : PackageEntry.Value)
+			{
+				OutFallbackAssets.Add(*AssetData);
+			}
+		}
+	}
+
+	int32 DeletePackageFiles(const TArray<FName>& PackageNames, TArray<FName>& OutFailedPackages,
+		TArray<FName>& OutPartlyDeletedPackages)
+	{
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		IFileManager& FileManager = IFileManager::Get();
+
+		TArray<FString> DeletedFilenames;
+		DeletedFilenames.Reserve(FMath::Min(PackageNames.Num(), RegistryNotifyBatchSize));
+
+		TArray<FString> PackageFilenames;
+		int32 NumDeleted = 0;
+
+		for (const FName& PackageName : PackageNames)
+		{
+			FString PackageFilename;
+
+			if (!FPackageName::DoesPackageExist(PackageName.ToString(), &PackageFilename))
+			{
+				OutFailedPackages.Add(PackageName);
+				continue;
+			}
+
+			// Main file first : once it is gone nothing loads the package, whatever split file is left behind
+			PackageFilenames.Reset();
+			PackageFilenames.Add(PackageFilename);
+			SuperManagerPackageSizes::GetSplitPackageFiles(PackageFilename, PackageFilenames);
+
+			// Untouched packages that fail here can still take the regular path
+			if (!CanDeleteFiles(PackageFilenames) || !FileManager.Delete(*PackageFilename, false, false, true))
+			{
+				OutFailedPackages.Add(PackageName);
+				continue;
+			}
+
+			bool bDeletedSplitFiles = true;
+
+			for (int32 FileIndex = 1; FileIndex < PackageFilenames.Num(); ++FileIndex)
+			{
+				bDeletedSplitFiles &= FileManager.Delete(*PackageFilenames[FileIndex], false, false, true);
+			}
+
+			if (bDeletedSplitFiles)
+			{
+				++NumDeleted;
+			}
+			else
+			{
+				OutPartlyDeletedPackages.Add(PackageName);
+			}
+
+			DeletedFilenames.Add(FPaths::ConvertRelativePathToFull(PackageFilename));
+
+			// Rescanning a missing file drops its assets from the registry, which also updates the content browser
+			if (DeletedFilenames.Num() >= RegistryNotifyBatchSize)
+			{
+				AssetRegistry.ScanModifiedAssetFiles(DeletedFilenames);
+				DeletedFilenames.Reset();
+			}
+		}
+
+		if (DeletedFilenames.Num() > 0)
+		{
+			AssetRegistry.ScanModifiedAssetFiles(DeletedFilenames);
+		}
+
+		return NumDeleted;
+	}
+}
@@ -0,0 +1,170 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerPackageSizes.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include "Misc/PackageName.h"
+#include "UObject/PackageFileSummary.h"
+
+namespace SuperManagerPackageSizes
+{
+	// Written next to the package file when the editor splits exports or bulk data out
+	static const TCHAR* SplitPackageExtensions[] = { TEXT(".uexp"), TEXT(".ubulk"), TEXT(".uptnl") };
+
+	void GetSplitPackageFiles(const FString& PackageFilename, TArray<FString>& OutFilenames)
+	{
+		IFileManager& FileManager = IFileManager::Get();
+
+		for (const TCHAR* Extension : SplitPackageExtensions)
+		{
+			FString SplitFilename = FPaths::ChangeExtension(PackageFilename, Extension);
+
+			if (FileManager.FileExists(*SplitFilename))
+			{
+				OutFilenames.Add(MoveTemp(SplitFilename));
+			}
+		}
+	}
+
+	FSuperManagerPackageSize ReadPackageSize(FName PackageName)
+	{
+		FSuperManagerPackageSize PackageSize;
+
+		FString PackageFilename;
+		if (!FPackageName::DoesPackageExist(PackageName.ToString(), &PackageFilename)) return PackageSize;
+
+		IFileManager& FileManager = IFileManager::Get();
+
+		PackageSize.DiskBytes = FMath::Max<int64>(FileManager.FileSize(*PackageFilename), 0);
+
+		for (const TCHAR* Extension : SplitPackageExtensions)
+		{
+			PackageSize.DiskBytes += FMath::Max<int64>(FileManager.FileSize(*FPaths::ChangeExtension(PackageFilename, Extension)), 0);
+		}
+
+		PackageSize.EstimatedCookedBytes = PackageSize.DiskBytes;
+
+		// Only the summary at the start of the file is read
+		TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*PackageFilename, FILEREAD_Silent));
+		if (!Reader.IsValid()) return PackageSize;
+
+		FPackageFileSummary Summary;
+		*Reader << Summary;
+
+		if (!Reader->IsError() && Summary.Tag == PACKAGE_FILE_TAG && Summary.TotalHeaderSize > 0)
+		{
+			PackageSize.EstimatedCookedBytes = FMath::Max<int64>(PackageSize.DiskBytes - Summary.TotalHeaderSize, 0);
+		}
+
+		return PackageSize;
+	}
+
+	void GatherPackageSizes(const TArray<FName>& PackageNames,
+		TMap<FName, FSuperManagerPackageSize>& InOutPackageSizes, int32 NumWorkers)
+	{
+		TArray<FName> PackagesToRead;
+		TSet<FName> SeenPackages;
+
+		for (const FName& PackageName : PackageNames)
+		{
+			if (InOutPackageSizes.Contains(PackageName)) continue;
+
+			bool bAlreadySeen = false;
+			SeenPackages.Add(PackageName, &bAlreadySeen);
+
+			if (!bAlreadySeen)
+			{
+				PackagesToRead.Add(PackageName);
+			}
+		}
+
+		TArray<FSuperManagerPackageSize> ReadSizes;
+		ReadSizes.Reserve(PackagesToRead.Num());
+
+		SuperManagerParallel::ParallelGather(PackagesToRead.Num(), NumWorkers, ReadSizes,
+			[&PackagesToRead](int32 PackageIndex, TArray<FSuperManagerPackageSize>& ChunkSizes)
+			{
+				ChunkSizes.Add(ReadPackageSize(PackagesToRead[PackageIndex]));
+			});
+
+		for (int32 PackageIndex = 0; PackageIndex < PackagesToRead.Num(); ++PackageIndex)
+		{
+			InOutPackageSizes.Add(PackagesToRead[PackageIndex], ReadSizes[PackageIndex]);
+		}
+	}
+
+	void GatherPackageSizes(FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows, int32 NumWorkers)
+	{
+		TArray<FName> PackageNames;
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			if (!AssetTable.HasSize(Row))
+			{
+				PackageNames.Add(AssetTable.GetPackageName(Row));
+			}
+		}
+
+		TMap<FName, FSuperManagerPackageSize> PackageSizes;
+		GatherPackageSizes(PackageNames, PackageSizes, NumWorkers);
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			if (const FSuperManagerPackageSize* PackageSize = PackageSizes.Find(AssetTable.GetPackageName(Row)))
+			{
+				AssetTable.SetSize(Row, *PackageSize);
+			}
+		}
+	}
+
+	void RollUpByFolder(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		TArray<TSharedPtr<FSuperManagerFolderSize>>& OutFolderSizes)
+	{
+		OutFolderSizes.Empty();
+
+		TMap<FString, TSharedPtr<FSuperManagerFolderSize>> FolderSizes;
+		TSet<FName> CountedPackages;
+
+		for (const FSuperManagerAssetRowId& Row : Rows)
+		{
+			if (!AssetTable.HasSize(Row)) continue;
+
+			// Several assets can live in one package, it is only freed once
+			bool bAlreadyCounted = false;
+			CountedPackages.Add(AssetTable.GetPackageName(Row), &bAlreadyCounted);
+			if (bAlreadyCounted) continue;
+
+			const FSuperManagerPackageSize PackageSize = AssetTable.GetSize(Row);
+
+			FString FolderPath = FPackageName::GetLongPackagePath(AssetTable.GetPackageName(Row).ToString());
+
+			while (!FolderPath.IsEmpty() && FolderPath != TEXT("/"))
+			{
+				TSharedPtr<FSuperManagerFolderSize>& FolderSize = FolderSizes.FindOrAdd(FolderPath);
+
+				if (!FolderSize.IsValid())
+				{
+					FolderSize = MakeShared<FSuperManagerFolderSize>();
+					FolderSize->FolderPath = FolderPath;
+				}
+
+				FolderSize->Size.DiskBytes += PackageSize.DiskBytes;
+				FolderSize->Size.EstimatedCookedBytes += PackageSize.EstimatedCookedBytes;
+				++FolderSize->NumPackages;
+
+				int32 LastSlashIndex = INDEX_NONE;
+				if (!FolderPath.FindLastChar(TEXT('/'), LastSlashIndex) || LastSlashIndex == 0) break;
+
+				FolderPath.LeftInline(LastSlashIndex);
+			}
+		}
+
+		FolderSizes.GenerateValueArray(OutFolderSizes);
+
+		OutFolderSizes.Sort([](const TSharedPtr<FSuperManagerFolderSize>& A, const TSharedPtr<FSuperManagerFolderSize>& B)
+		{
+			return A->Size.DiskBytes != B->Size.DiskBytes ? A->Size.DiskBytes > B->Size.DiskBytes : A->FolderPath < B->FolderPath;
+		});
+	}
+}
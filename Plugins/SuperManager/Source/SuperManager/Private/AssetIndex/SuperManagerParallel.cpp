@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerParallel.h"
+#include "Settings/SuperManagerSettings.h"
+
+namespace SuperManagerParallel
+{
+	int32 GetNumWorkers()
+	{
+		const int32 ConfiguredWorkers = USuperManagerSettings::Get()->ScanWorkerCount;
+
+		return ConfiguredWorkers > 0 ? ConfiguredWorkers : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	}
+}
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerPathExclusion.h"
+#include "DebugHeader.h"
+
+void FSuperManagerPathExclusion::Compile(const TArray<FString>& Rules)
+{
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+
+	TArray<FString> Segments;
+
+	for (const FString& Rule : Rules)
+	{
+		Segments.Reset();
+		Rule.ParseIntoArray(Segments, TEXT("/"), true);
+
+		if (!Rule.StartsWith(TEXT("/")) || Segments.Num() == 0)
+		{
+			DebugHeader::PrintLog(TEXT("SuperManager : ignoring exclusion rule \"") + Rule + TEXT("\", rules are absolute paths"));
+			continue;
+		}
+
+		int32 NodeIndex = 0;
+
+		for (const FString& Segment : Segments)
+		{
+			NodeIndex = FindOrAddChild(NodeIndex, Segment);
+		}
+
+		Nodes[NodeIndex].bTerminal = true;
+	}
+
+	CompiledRules = Rules;
+
+	FWriteScopeLock WriteLock(CacheLock);
+	PackagePathCache.Reset();
+}
+
+bool FSuperManagerPathExclusion::IsPackagePathExcluded(FName PackagePath) const
+{
+	if (Nodes.Num() <= 1 || PackagePath.IsNone()) return false;
+
+	{
+		FReadScopeLock ReadLock(CacheLock);
+
+		if (const bool* bCachedExcluded = PackagePathCache.Find(PackagePath))
+		{
+			return *bCachedExcluded;
+		}
+	}
+
+	// Thousands of assets share a handful of folders, the trie walk runs once per folder
+	TCHAR PackagePathBuffer[NAME_SIZE];
+	const uint32 PackagePathLength = PackagePath.ToString(PackagePathBuffer);
+
+	const bool bExcluded = IsPathExcluded(FStringView(PackagePathBuffer, PackagePathLength));
+
+	FWriteScopeLock WriteLock(CacheLock);
+	PackagePathCache.Add(PackagePath, bExcluded);
+
+	return bExcluded;
+}
+
+bool FSuperManagerPathExclusion::IsPathExcluded(FStringView Path) const
+{
+	if (Nodes.Num() <= 1) return false;
+
+	FActiveNodes ActiveNodes;
+	FActiveNodes NextNodes;
+
+	AddActiveNode(0, ActiveNodes);
+
+	int32 SegmentStart = 0;
+
+	while (SegmentStart < Path.Len())
+	{
+		int32 SegmentEnd = SegmentStart;
+		while (SegmentEnd < Path.Len() && Path[SegmentEnd] != TEXT('/'))
+		{
+			++SegmentEnd;
+		}
+
+		const FStringView Segment = Path.Mid(SegmentStart, SegmentEnd - SegmentStart);
+		SegmentStart = SegmentEnd + 1;
+
+		if (Segment.IsEmpty()) continue;
+
+		// Rule literals were added as FNames, a folder name that was never made into one can not match them
+		const FName SegmentName(Segment.Len(), Segment.GetData(), FNAME_Find);
+
+		NextNodes.Reset();
+
+		for (const int32 NodeIndex : ActiveNodes)
+		{
+			const FNode& Node = Nodes[NodeIndex];
+
+			if (Node.bAnyDepth)
+			{
+				AddActiveNode(NodeIndex, NextNodes);
+			}
+
+			if (!SegmentName.IsNone())
+			{
+				if (const int32* ChildIndex = Node.LiteralChildren.Find(SegmentName))
+				{
+					AddActiveNode(*ChildIndex, NextNodes);
+				}
+			}
+
+			if (Node.AnySegmentChild != INDEX_NONE)
+			{
+				AddActiveNode(Node.AnySegmentChild, NextNodes);
+			}
+
+			for (const TPair<FString, int32>& WildcardChild : Node.WildcardChildren)
+			{
+				if (FString(Segment).MatchesWildcard(WildcardChild.Key))
+				{
+					AddActiveNode(WildcardChild.Value, NextNodes);
+				}
+			}
+		}
+
+		if (NextNodes.Num() == 0) return false;
+
+		for (const int32 NodeIndex : NextNodes)
+		{
+			if (Nodes[NodeIndex].bTerminal) return true;
+		}
+
+		Swap(ActiveNodes, NextNodes);
+	}
+
+	return false;
+}
+
+int32 FSuperManagerPathExclusion::FindOrAddChild(int32 ParentIndex, const FString& Segment)
+{
+	// Nodes can reallocate below, only indices are kept
+	if (Segment == TEXT("**"))
+	{
+		if (Nodes[ParentIndex].AnyDepthChild == INDEX_NONE)
+		{
+			const int32 ChildIndex = Nodes.AddDefaulted();
+			Nodes[ChildIndex].bAnyDepth = true;
+			Nodes[ParentIndex].AnyDepthChild = ChildIndex;
+		}
+
+		return Nodes[ParentIndex].AnyDepthChild;
+	}
+
+	if (Segment == TEXT("*"))
+	{
+		if (Nodes[ParentIndex].AnySegmentChild == INDEX_NONE)
+		{
+			const int32 ChildIndex = Nodes.AddDefaulted();
+			Nodes[ParentIndex].AnySegmentChild = ChildIndex;
+		}
+
+		return Nodes[ParentIndex].AnySegmentChild;
+	}
+
+	if (Segment.Contains(TEXT("*")) || Segment.Contains(TEXT("?")))
+	{
+		for (const TPair<FString, int32>& WildcardChild : Nodes[ParentIndex].WildcardChildren)
+		{
+			if (WildcardChild.Key == Segment) return WildcardChild.Value;
+		}
+
+		const int32 ChildIndex = Nodes.AddDefaulted();
+		Nodes[ParentIndex].WildcardChildren.Emplace(Segment, ChildIndex);
+
+		return ChildIndex;
+	}
+
+	const FName SegmentName(*Segment);
+
+	if (const int32* ExistingChildIndex = Nodes[ParentIndex].LiteralChildren.Find(SegmentName))
+	{
+		return *ExistingChildIndex;
+	}
+
+	const int32 ChildIndex = Nodes.AddDefaulted();
+	Nodes[ParentIndex].LiteralChildren.Add(SegmentName, ChildIndex);
+
+	return ChildIndex;
+}
+
+void FSuperManagerPathExclusion::AddActiveNode(int32 NodeIndex, FActiveNodes& OutActiveNodes) const
+{
+	// A '**' child matches zero folders too, so it is active as soon as its parent is
+	while (NodeIndex != INDEX_NONE)
+	{
+		OutActiveNodes.AddUnique(NodeIndex);
+		NodeIndex = Nodes[NodeIndex].AnyDepthChild;
+	}
+}
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerPathExclusion.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "SuperManager.h"
+
+/**
+ * SuperManager.BenchmarkPathExclusion [PackagePath]
+ * Times the per path exclusion check over every asset under PackagePath (default /Game) :
+ * the old four substring scans, the compiled trie on the object path string, and the cached package path lookup.
+ */
+namespace SuperManagerPathExclusionBenchmark
+{
+	static const int32 NumIterations = 5;
+
+	/** Best time of running Check on every path, and how many paths it excluded */
+	template<typename CheckType>
+	static double TimeCheck(int32 NumPaths, const CheckType& Check, int32& OutNumExcluded)
+	{
+		return FSuperManagerBenchmark::TimePass([NumPaths, &Check]()
+		{
+			int32 NumExcluded = 0;
+
+			for (int32 PathIndex = 0; PathIndex < NumPaths; ++PathIndex)
+			{
+				NumExcluded += Check(PathIndex) ? 1 : 0;
+			}
+
+			return NumExcluded;
+		}, OutNumExcluded, NumIterations);
+	}
+
+	static void LogResult(const FSuperManagerBenchmark& Benchmark, const TCHAR* CheckName, int32 NumPaths, double Seconds, int32 NumExcluded)
+	{
+		Benchmark.LogResult(CheckName, FString::Printf(TEXT("%d paths, %.1f ns/path, %d excluded"),
+			NumPaths, Seconds * 1e9 / FMath::Max(NumPaths, 1), NumExcluded));
+	}
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Emplace(*FSuperManagerBenchmark::GetPackagePathArgument(Args));
+
+		TArray<FAssetData> AssetsData;
+		IAssetRegistry::GetChecked().GetAssets(Filter, AssetsData);
+
+		if (AssetsData.Num() == 0)
+		{
+			Benchmark.LogMessage(TEXT("no assets under ") + Filter.PackagePaths[0].ToString());
+			return;
+		}
+
+		TArray<FString> ObjectPaths;
+		ObjectPaths.Reserve(AssetsData.Num());
+
+		for (const FAssetData& AssetData : AssetsData)
+		{
+			ObjectPaths.Add(AssetData.GetSoftObjectPath().ToString());
+		}
+
+		const FSuperManagerPathExclusion& Exclusion =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager")).GetPathExclusion();
+
+		int32 NumExcluded = 0;
+
+		double Seconds = TimeCheck(ObjectPaths.Num(), [&ObjectPaths](int32 PathIndex)
+		{
+			const FString& AssetPathName = ObjectPaths[PathIndex];
+
+			return AssetPathName.Contains(TEXT("Developers")) ||
+				AssetPathName.Contains(TEXT("Collections")) ||
+				AssetPathName.Contains(TEXT("__ExternalActors__")) ||
+				AssetPathName.Contains(TEXT("__ExternalObject__"));
+		}, NumExcluded);
+		LogResult(Benchmark, TEXT("substring (old)"), ObjectPaths.Num(), Seconds, NumExcluded);
+
+		Seconds = TimeCheck(ObjectPaths.Num(), [&ObjectPaths, &Exclusion](int32 PathIndex)
+		{
+			return Exclusion.IsPathExcluded(ObjectPaths[PathIndex]);
+		}, NumExcluded);
+		LogResult(Benchmark, TEXT("trie, object path"), ObjectPaths.Num(), Seconds, NumExcluded);
+
+		Seconds = TimeCheck(AssetsData.Num(), [&AssetsData, &Exclusion](int32 PathIndex)
+		{
+			return Exclusion.IsPackagePathExcluded(AssetsData[PathIndex].PackagePath);
+		}, NumExcluded);
+		LogResult(Benchmark, TEXT("trie, cached FName"), AssetsData.Num(), Seconds, NumExcluded);
+	}
+
+	static FSuperManagerBenchmark BenchmarkPathExclusion(
+		TEXT("SuperManager.BenchmarkPathExclusion"),
+		TEXT("Measure the per path cost of the exclusion rules against the old substring checks. Optional argument : package path"),
+		&Run);
+}
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerRedirectorAudit.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ScopedTransaction.h"
+
+namespace SuperManagerRedirectorAudit
+{
+	// Written by UObjectRedirector::GetAssetRegistryTags
+	static const FName DestinationObjectTag(TEXT("DestinationObject"));
+
+	static FSoftObjectPath ReadDestination(const IAssetRegistry& AssetRegistry, const FAssetData& RedirectorData)
+	{
+		FString DestinationPath;
+
+		if (RedirectorData.GetTagValue(DestinationObjectTag, DestinationPath) && DestinationPath != TEXT("None"))
+		{
+			return FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(DestinationPath));
+		}
+
+		// Old packages without the tag : the redirector package only depends on its destination
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(RedirectorData.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+		if (Dependencies.Num() != 1) return FSoftObjectPath();
+
+		TArray<FAssetData> DestinationAssets;
+		AssetRegistry.GetAssetsByPackageName(Dependencies[0], DestinationAssets, true);
+
+		return DestinationAssets.Num() > 0 ? DestinationAssets[0].GetSoftObjectPath() : FSoftObjectPath();
+	}
+
+	void BuildRedirectorChains(const TArray<FString>& FolderPaths, TArray<FSuperManagerRedirectorChain>& OutChains)
+	{
+		const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		// The whole project, a chain can leave the audited folder
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Emplace("/Game");
+		Filter.ClassNames.Emplace("ObjectRedirector");
+
+		TArray<FAssetData> RedirectorsData;
+		AssetRegistry.GetAssets(Filter, RedirectorsData);
+
+		TMap<FSoftObjectPath, FSoftObjectPath> Destinations;
+		Destinations.Reserve(RedirectorsData.Num());
+
+		for (const FAssetData& RedirectorData : RedirectorsData)
+		{
+			Destinations.Add(RedirectorData.GetSoftObjectPath(), ReadDestination(AssetRegistry, RedirectorData));
+		}
+
+		TArray<FString> FolderPrefixes;
+
+		for (FString FolderPrefix : FolderPaths)
+		{
+			FolderPrefix.RemoveFromEnd(TEXT("/"));
+			FolderPrefixes.Add(FolderPrefix + TEXT("/"));
+		}
+
+		TArray<FName> Referencers;
+		TArray<FAssetData> ReferencerAssets;
+
+		for (const FAssetData& RedirectorData : RedirectorsData)
+		{
+			const FString PackageName = RedirectorData.PackageName.ToString();
+
+			const bool bUnderFolders = FolderPrefixes.ContainsByPredicate([&PackageName](const FString& FolderPrefix)
+			{
+				return PackageName.StartsWith(FolderPrefix);
+			});
+
+			if (!bUnderFolders) continue;
+
+			FSuperManagerRedirectorChain& Chain = OutChains.AddDefaulted_GetRef();
+			Chain.Redirector = RedirectorData.GetSoftObjectPath();
+
+			TSet<FSoftObjectPath> Visited;
+			Visited.Add(Chain.Redirector);
+
+			FSoftObjectPath Destination = Destinations.FindRef(Chain.Redirector);
+
+			while (const FSoftObjectPath* NextDestination = Destinations.Find(Destination))
+			{
+				bool bAlreadyVisited = false;
+				Visited.Add(Destination, &bAlreadyVisited);
+
+				if (bAlreadyVisited)
+				{
+					Chain.bCycle = true;
+					break;
+				}
+
+				Chain.FollowingRedirectors.Add(Destination);
+				Destination = *NextDestination;
+			}
+
+			if (!Chain.bCycle)
+			{
+				Chain.FinalTarget = Destination;
+			}
+
+			Referencers.Reset();
+			AssetRegistry.GetReferencers(RedirectorData.PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package);
+
+			for (const FName& Referencer : Referencers)
+			{
+				ReferencerAssets.Reset();
+				AssetRegistry.GetAssetsByPackageName(Referencer, ReferencerAssets, true);
+
+				const bool bReferencerIsRedirector = ReferencerAssets.Num() > 0 && ReferencerAssets[0].IsRedirector();
+				Chain.NumReferencers += bReferencerIsRedirector ? 0 : 1;
+			}
+		}
+
+		OutChains.Sort([](const FSuperManagerRedirectorChain& A, const FSuperManagerRedirectorChain& B)
+		{
+			if (A.GetChainLength() != B.GetChainLength()) return A.GetChainLength() > B.GetChainLength();
+			return A.NumReferencers > B.NumReferencers;
+		});
+	}
+
+	int32 FixRedirectorChains(const TArray<FSuperManagerRedirectorChain>& Chains, bool bCheckoutDialogPrompt)
+	{
+		FScopedSlowTask SlowTask(Chains.Num(), FText::FromString(TEXT("Collapsing redirector chains")));
+
+		TArray<UObjectRedirector*> RedirectorsToFix;
+		RedirectorsToFix.Reserve(Chains.Num());
+
+		// Chains share their tails, every redirector is handed over once
+		TSet<FSoftObjectPath> QueuedRedirectors;
+
+		auto QueueRedirector = [&RedirectorsToFix, &QueuedRedirectors](const FSoftObjectPath& RedirectorPath)
+		{
+			bool bAlreadyQueued = false;
+			QueuedRedirectors.Add(RedirectorPath, &bAlreadyQueued);
+
+			if (bAlreadyQueued) return;
+
+			if (UObjectRedirector* Redirector = Cast<UObjectRedirector>(RedirectorPath.TryLoad()))
+			{
+				RedirectorsToFix.Add(Redirector);
+			}
+		};
+
+		for (const FSuperManagerRedirectorChain& Chain : Chains)
+		{
+			SlowTask.EnterProgressFrame();
+
+			// A cycle has nowhere to point its referencers, it is only reported
+			if (Chain.bCycle) continue;
+
+			// The whole chain, hops outside the audited folders included. A loaded redirector resolves
+			// through the rest of its chain, so every referencer is saved pointing at the final target
+			QueueRedirector(Chain.Redirector);
+
+			for (const FSoftObjectPath& FollowingRedirector : Chain.FollowingRedirectors)
+			{
+				QueueRedirector(FollowingRedirector);
+			}
+		}
+
+		if (RedirectorsToFix.Num() > 0)
+		{
+			FAssetToolsModule& AssetToolsModule =
+				FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+
+			// One transaction and one fixup for every chain, the fixup saves each referencer it rewrites
+			const FScopedTransaction Transaction(FText::FromString(TEXT("Collapse Redirector Chains")));
+
+			AssetToolsModule.Get().FixupReferencers(RedirectorsToFix, bCheckoutDialogPrompt);
+		}
+
+		return RedirectorsToFix.Num();
+	}
+
+	FString DescribeChains(const TArray<FSuperManagerRedirectorChain>& Chains)
+	{
+		int32 NumInChains = 0;
+		int32 NumCycles = 0;
+		int32 LongestChain = 0;
+		int32 NumReferencers = 0;
+
+		for (const FSuperManagerRedirectorChain& Chain : Chains)
+		{
+			NumInChains += Chain.GetChainLength() > 1 ? 1 : 0;
+			NumCycles += Chain.bCycle ? 1 : 0;
+			LongestChain = FMath::Max(LongestChain, Chain.GetChainLength());
+			NumReferencers += Chain.NumReferencers;
+		}
+
+		return FString::Printf(TEXT("%d redirectors, %d start a chain (longest %d), %d in a cycle, %d referencers affected"),
+			Chains.Num(), NumInChains, LongestChain, NumCycles, NumReferencers);
+	}
+}
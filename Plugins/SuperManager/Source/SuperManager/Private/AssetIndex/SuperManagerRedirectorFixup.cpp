@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerRedirectorFixup.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "DebugHeader.h"
+
+int32 FSuperManagerRedirectorFixup::FixUpRedirectors(const TArray<FString>& FolderPaths)
+{
+	TArray<FString> ScopePrefixes;
+
+	for (const FString& FolderPath : FolderPaths)
+	{
+		FString ScopePrefix = FolderPath;
+		ScopePrefix.RemoveFromEnd(TEXT("/"));
+		ScopePrefixes.AddUnique(ScopePrefix + TEXT("/"));
+	}
+
+	ScopePrefixes.Sort();
+
+	const FString ScopeKey = FString::Join(ScopePrefixes, TEXT(";"));
+
+	if (const uint64* FixedGeneration = FixedGenerations.Find(ScopeKey))
+	{
+		if (*FixedGeneration == RedirectorGeneration) return 0;
+	}
+
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.PackagePaths.Emplace("/Game");
+	Filter.ClassNames.Emplace("ObjectRedirector");
+
+	TArray<FAssetData> RedirectorsData;
+	AssetRegistry.GetAssets(Filter, RedirectorsData);
+
+	auto IsInScope = [&ScopePrefixes](FName PackageName)
+	{
+		const FString PackageNameString = PackageName.ToString();
+
+		return ScopePrefixes.ContainsByPredicate([&PackageNameString](const FString& ScopePrefix)
+		{
+			return PackageNameString.StartsWith(ScopePrefix);
+		});
+	};
+
+	TArray<UObjectRedirector*> RedirectorsToFix;
+	TArray<FName> RedirectorDependencies;
+
+	for (const FAssetData& RedirectorData : RedirectorsData)
+	{
+		bool bAffectsScope = IsInScope(RedirectorData.PackageName);
+
+		// A redirector depends on the package it points to
+		if (!bAffectsScope)
+		{
+			RedirectorDependencies.Reset();
+			AssetRegistry.GetDependencies(RedirectorData.PackageName, RedirectorDependencies,
+				UE::AssetRegistry::EDependencyCategory::Package);
+
+			bAffectsScope = RedirectorDependencies.ContainsByPredicate(IsInScope);
+		}
+
+		if (!bAffectsScope) continue;
+
+		if (UObjectRedirector* RedirectorToFix = Cast<UObjectRedirector>(RedirectorData.GetAsset()))
+		{
+			RedirectorsToFix.Add(RedirectorToFix);
+		}
+	}
+
+	bool bAllFixed = true;
+
+	if (RedirectorsToFix.Num() > 0)
+	{
+		TArray<FName> RedirectorPackages;
+
+		for (const UObjectRedirector* RedirectorToFix : RedirectorsToFix)
+		{
+			RedirectorPackages.Add(RedirectorToFix->GetPackage()->GetFName());
+		}
+
+		FAssetToolsModule& AssetToolsModule =
+			FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+
+		// One call for the whole scope : every referencer is loaded once and all of them are saved together
+		AssetToolsModule.Get().FixupReferencers(RedirectorsToFix, !DebugHeader::IsHeadless());
+
+		// A redirector is only deleted once every referencer was saved, one left behind means a fixup failed
+		TArray<FAssetData> PackageAssets;
+
+		for (const FName& RedirectorPackage : RedirectorPackages)
+		{
+			PackageAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(RedirectorPackage, PackageAssets, true);
+
+			bAllFixed &= !PackageAssets.ContainsByPredicate([](const FAssetData& AssetData)
+			{
+				return AssetData.IsRedirector();
+			});
+		}
+	}
+
+	// Read after the fixup, the redirectors it deleted are not a reason to run again.
+	// After a failure the scope stays unfixed so the next call tries again
+	if (bAllFixed)
+	{
+		FixedGenerations.Add(ScopeKey, RedirectorGeneration);
+	}
+
+	return RedirectorsToFix.Num();
+}
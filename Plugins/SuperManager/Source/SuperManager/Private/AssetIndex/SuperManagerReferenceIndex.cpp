@@ -0,0 +1,556 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerReferenceIndex.h"
+#include "AssetIndex/SuperManagerCacheFile.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/FileHelper.h"
+#include "Hash/CityHash.h"
+
+namespace SuperManagerReferenceCache
+{
+	static const uint32 Magic = 0x534D5247;	// "SMRG"
+	static const uint32 Version = 1;
+
+	// Smallest node on disk : empty name, timestamp, hash, no dependencies
+	static const int64 MinNodeBytes = sizeof(int32) + sizeof(int64) + sizeof(uint64) + sizeof(int32);
+
+	static bool ReadIndices(FArchive& Reader, TArray<int32>& OutIndices)
+	{
+		int32 NumIndices = 0;
+		Reader << NumIndices;
+
+		if (Reader.IsError() || !SuperManagerCacheFile::FitsInRemaining(Reader, NumIndices, sizeof(int32))) return false;
+
+		OutIndices.SetNumUninitialized(NumIndices);
+		Reader.Serialize(OutIndices.GetData(), NumIndices * sizeof(int32));
+
+		return !Reader.IsError();
+	}
+}
+
+void FSuperManagerReferenceIndex::Build()
+{
+	FWriteScopeLock WriteLock(IndexLock);
+
+	ResetNodes();
+
+	IAssetRegistry& AssetRegistry =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	// First pass : one node per on disk package.
+	// Script packages and missing packages never get a node, so edges to them are dropped below.
+	AssetRegistry.EnumerateAllAssets([this](const FAssetData& AssetData)
+	{
+		FindOrAddNode(AssetData.PackageName);
+		return true;
+	}, true);
+
+	// Second pass : forward edges from the registry, reverse edges recorded at the same time.
+	TArray<FName> ScratchNames;
+
+	TArray<int32> AllNodeIndices;
+	AllNodeIndices.Reserve(Nodes.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		LinkDependencies(AssetRegistry, NodeIndex, ScratchNames);
+		AllNodeIndices.Add(NodeIndex);
+	}
+
+	RefreshPackageKeys(AssetRegistry, AllNodeIndices);
+
+	bIsBuilt = true;
+}
+
+void FSuperManagerReferenceIndex::Reset()
+{
+	FWriteScopeLock WriteLock(IndexLock);
+
+	ResetNodes();
+}
+
+void FSuperManagerReferenceIndex::ResetNodes()
+{
+	Nodes.Empty();
+	PackageToNodeIndex.Empty();
+	DirtyPackages.Empty();
+	bIsBuilt = false;
+	bLoadedFromCache = false;
+}
+
+int32 FSuperManagerReferenceIndex::GetReferencerCount(FName PackageName) const
+{
+	FReadScopeLock ReadLock(IndexLock);
+
+	const int32* NodeIndex = PackageToNodeIndex.Find(PackageName);
+
+	return NodeIndex ? Nodes[*NodeIndex].Referencers.Num() : 0;
+}
+
+int64 FSuperManagerReferenceIndex::GetPackageTimeStamp(FName PackageName) const
+{
+	FReadScopeLock ReadLock(IndexLock);
+
+	const int32* NodeIndex = PackageToNodeIndex.Find(PackageName);
+
+	return NodeIndex ? Nodes[*NodeIndex].TimeStamp : 0;
+}
+
+void FSuperManagerReferenceIndex::GetReferencers(FName PackageName, TArray<FName>& OutReferencers) const
+{
+	OutReferencers.Reset();
+
+	FReadScopeLock ReadLock(IndexLock);
+
+	const int32* NodeIndex = PackageToNodeIndex.Find(PackageName);
+	if (!NodeIndex) return;
+
+	for (const int32 ReferencerIndex : Nodes[*NodeIndex].Referencers)
+	{
+		OutReferencers.Add(Nodes[ReferencerIndex].PackageName);
+	}
+}
+
+void FSuperManagerReferenceIndex::MarkReachableFrom(const TArray<FName>& RootPackages, TBitArray<>& OutReachableNodes) const
+{
+	FReadScopeLock ReadLock(IndexLock);
+
+	TBitArray<>& ReachableNodes = OutReachableNodes;
+	ReachableNodes.Init(false, Nodes.Num());
+
+	TArray<int32> PendingNodes;
+	PendingNodes.Reserve(Nodes.Num());
+
+	for (const FName& RootPackage : RootPackages)
+	{
+		const int32* RootIndex = PackageToNodeIndex.Find(RootPackage);
+		if (!RootIndex || ReachableNodes[*RootIndex]) continue;
+
+		ReachableNodes[*RootIndex] = true;
+		PendingNodes.Add(*RootIndex);
+	}
+
+	// Every node and edge is visited at most once
+	while (PendingNodes.Num() > 0)
+	{
+		const int32 NodeIndex = PendingNodes.Pop(false);
+
+		for (const int32 DependencyIndex : Nodes[NodeIndex].Dependencies)
+		{
+			if (ReachableNodes[DependencyIndex]) continue;
+
+			ReachableNodes[DependencyIndex] = true;
+			PendingNodes.Add(DependencyIndex);
+		}
+	}
+}
+
+bool FSuperManagerReferenceIndex::IsPackageReachable(FName PackageName, const TBitArray<>& ReachableNodes) const
+{
+	FReadScopeLock ReadLock(IndexLock);
+
+	const int32* NodeIndex = PackageToNodeIndex.Find(PackageName);
+
+	if (!NodeIndex || !ReachableNodes.IsValidIndex(*NodeIndex)) return true;
+
+	return ReachableNodes[*NodeIndex];
+}
+
+#pragma region IncrementalUpdate
+
+void FSuperManagerReferenceIndex::MarkPackageDirty(FName PackageName)
+{
+	// The initial Build or the cache revalidation picks up everything, no need to track changes before it
+	if (!bIsBuilt || bLoadedFromCache) return;
+
+	DirtyPackages.Add(PackageName);
+}
+
+void FSuperManagerReferenceIndex::FlushPendingChanges()
+{
+	if (DirtyPackages.Num() == 0) return;
+
+	TArray<FName> ChangedPackages;
+
+	{
+		FWriteScopeLock WriteLock(IndexLock);
+		RelinkDirtyPackages(&ChangedPackages);
+	}
+
+	// Outside the lock, listeners read the index
+	if (ChangedPackages.Num() > 0)
+	{
+		ReferencersChangedDelegate.Broadcast(ChangedPackages);
+	}
+}
+
+void FSuperManagerReferenceIndex::RelinkDirtyPackages(TArray<FName>* OutChangedPackages)
+{
+	IAssetRegistry& AssetRegistry =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<FAssetData> PackageAssets;
+	TArray<FName> ScratchNames;
+	TArray<int32> RelinkedNodeIndices;
+
+	// The dirty packages, and the old and new dependencies whose referencer lists were edited
+	TSet<int32> ChangedNodeIndices;
+
+	auto AddChangedNodes = [&ChangedNodeIndices, OutChangedPackages](int32 NodeIndex, const TArray<int32>& Dependencies)
+	{
+		if (!OutChangedPackages) return;
+
+		ChangedNodeIndices.Add(NodeIndex);
+		ChangedNodeIndices.Append(Dependencies);
+	};
+
+	for (const FName& PackageName : DirtyPackages)
+	{
+		PackageAssets.Reset();
+		AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+
+		const int32* ExistingIndex = PackageToNodeIndex.Find(PackageName);
+
+		if (PackageAssets.Num() == 0)
+		{
+			// Package deleted or renamed away. Referencers keep their (now broken) edges to it
+			if (ExistingIndex)
+			{
+				AddChangedNodes(*ExistingIndex, Nodes[*ExistingIndex].Dependencies);
+				UnlinkDependencies(*ExistingIndex);
+				Nodes[*ExistingIndex].bExists = false;
+			}
+			continue;
+		}
+
+		const bool bIsNewNode = !ExistingIndex || !Nodes[*ExistingIndex].bExists;
+		const int32 NodeIndex = FindOrAddNode(PackageName);
+
+		Nodes[NodeIndex].bExists = true;
+
+		AddChangedNodes(NodeIndex, Nodes[NodeIndex].Dependencies);
+		UnlinkDependencies(NodeIndex);
+		LinkDependencies(AssetRegistry, NodeIndex, ScratchNames);
+		AddChangedNodes(NodeIndex, Nodes[NodeIndex].Dependencies);
+
+		// Packages that referenced this one before it had a node lost that edge, pick them up again
+		if (bIsNewNode)
+		{
+			LinkReferencers(AssetRegistry, NodeIndex, ScratchNames);
+		}
+
+		RelinkedNodeIndices.Add(NodeIndex);
+	}
+
+	RefreshPackageKeys(AssetRegistry, RelinkedNodeIndices);
+
+	if (OutChangedPackages)
+	{
+		for (const int32 ChangedNodeIndex : ChangedNodeIndices)
+		{
+			OutChangedPackages->Add(Nodes[ChangedNodeIndex].PackageName);
+		}
+	}
+
+	DirtyPackages.Empty();
+}
+
+void FSuperManagerReferenceIndex::LinkDependencies(IAssetRegistry& AssetRegistry, int32 NodeIndex, TArray<FName>& ScratchNames)
+{
+	ScratchNames.Reset();
+	AssetRegistry.GetDependencies(Nodes[NodeIndex].PackageName, ScratchNames,
+		UE::AssetRegistry::EDependencyCategory::Package);
+
+	for (const FName& Dependency : ScratchNames)
+	{
+		const int32* DependencyIndex = PackageToNodeIndex.Find(Dependency);
+
+		if (!DependencyIndex || *DependencyIndex == NodeIndex) continue;
+
+		Nodes[NodeIndex].Dependencies.Add(*DependencyIndex);
+		Nodes[*DependencyIndex].Referencers.Add(NodeIndex);
+	}
+}
+
+void FSuperManagerReferenceIndex::LinkReferencers(IAssetRegistry& AssetRegistry, int32 NodeIndex, TArray<FName>& ScratchNames)
+{
+	ScratchNames.Reset();
+	AssetRegistry.GetReferencers(Nodes[NodeIndex].PackageName, ScratchNames,
+		UE::AssetRegistry::EDependencyCategory::Package);
+
+	for (const FName& Referencer : ScratchNames)
+	{
+		const int32* ReferencerIndex = PackageToNodeIndex.Find(Referencer);
+
+		if (!ReferencerIndex || *ReferencerIndex == NodeIndex) continue;
+		if (Nodes[*ReferencerIndex].Dependencies.Contains(NodeIndex)) continue;
+
+		Nodes[*ReferencerIndex].Dependencies.Add(NodeIndex);
+		Nodes[NodeIndex].Referencers.Add(*ReferencerIndex);
+	}
+}
+
+void FSuperManagerReferenceIndex::UnlinkDependencies(int32 NodeIndex)
+{
+	for (const int32 DependencyIndex : Nodes[NodeIndex].Dependencies)
+	{
+		Nodes[DependencyIndex].Referencers.RemoveSingleSwap(NodeIndex, false);
+	}
+
+	Nodes[NodeIndex].Dependencies.Reset();
+}
+
+#pragma endregion
+
+#pragma region PersistentCache
+
+FString FSuperManagerReferenceIndex::GetDefaultCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SuperManager") / TEXT("ReferenceGraph.bin");
+}
+
+bool FSuperManagerReferenceIndex::LoadFromCache(const FString& CacheFilename)
+{
+	FWriteScopeLock WriteLock(IndexLock);
+
+	ResetNodes();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*CacheFilename)) return false;
+
+	// Every node is deserialized anyway, so the file is read in one go
+	TArray<uint8> CacheBytes;
+
+	if (!FFileHelper::LoadFileToArray(CacheBytes, *CacheFilename) ||
+		!ReadCache(CacheBytes.GetData(), CacheBytes.Num()))
+	{
+		ResetNodes();
+		return false;
+	}
+
+	bIsBuilt = true;
+	bLoadedFromCache = true;
+
+	return true;
+}
+
+bool FSuperManagerReferenceIndex::ReadCache(const uint8* CacheData, int64 CacheSize)
+{
+	FMemoryReaderView Reader(TArrayView<const uint8>(CacheData, CacheSize));
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumNodes = 0;
+
+	Reader << Magic << Version << NumNodes;
+
+	if (Reader.IsError() || Magic != SuperManagerReferenceCache::Magic ||
+		Version != SuperManagerReferenceCache::Version ||
+		!SuperManagerCacheFile::FitsInRemaining(Reader, NumNodes, SuperManagerReferenceCache::MinNodeBytes))
+	{
+		return false;
+	}
+
+	Nodes.SetNum(NumNodes);
+	PackageToNodeIndex.Reserve(NumNodes);
+
+	FString PackageNameString;
+
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		FPackageNode& Node = Nodes[NodeIndex];
+
+		if (!SuperManagerCacheFile::ReadString(Reader, PackageNameString)) return false;
+
+		Reader << Node.TimeStamp << Node.PackageHash;
+
+		if (!SuperManagerReferenceCache::ReadIndices(Reader, Node.Dependencies)) return false;
+
+		Node.PackageName = FName(*PackageNameString);
+		PackageToNodeIndex.Add(Node.PackageName, NodeIndex);
+	}
+
+	if (Reader.IsError()) return false;
+
+	// Only forward edges are stored, referencers are derived
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		for (const int32 DependencyIndex : Nodes[NodeIndex].Dependencies)
+		{
+			if (!Nodes.IsValidIndex(DependencyIndex)) return false;
+
+			Nodes[DependencyIndex].Referencers.Add(NodeIndex);
+		}
+	}
+
+	return true;
+}
+
+bool FSuperManagerReferenceIndex::SaveToCache(const FString& CacheFilename) const
+{
+	FReadScopeLock ReadLock(IndexLock);
+
+	if (!bIsBuilt) return false;
+
+	// Removed packages are dropped, so node indices are remapped on the way out
+	TArray<int32> SavedIndices;
+	SavedIndices.Init(INDEX_NONE, Nodes.Num());
+
+	int32 NumSavedNodes = 0;
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		if (Nodes[NodeIndex].bExists)
+		{
+			SavedIndices[NodeIndex] = NumSavedNodes++;
+		}
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CacheFilename));
+	if (!Writer.IsValid()) return false;
+
+	uint32 Magic = SuperManagerReferenceCache::Magic;
+	uint32 Version = SuperManagerReferenceCache::Version;
+
+	*Writer << Magic << Version << NumSavedNodes;
+
+	TArray<int32> SavedDependencies;
+
+	for (const FPackageNode& Node : Nodes)
+	{
+		if (!Node.bExists) continue;
+
+		SavedDependencies.Reset();
+
+		for (const int32 DependencyIndex : Node.Dependencies)
+		{
+			if (SavedIndices[DependencyIndex] != INDEX_NONE)
+			{
+				SavedDependencies.Add(SavedIndices[DependencyIndex]);
+			}
+		}
+
+		FString PackageNameString = Node.PackageName.ToString();
+		int64 TimeStamp = Node.TimeStamp;
+		uint64 PackageHash = Node.PackageHash;
+
+		*Writer << PackageNameString << TimeStamp << PackageHash << SavedDependencies;
+	}
+
+	return Writer->Close();
+}
+
+void FSuperManagerReferenceIndex::RevalidateAgainstRegistry()
+{
+	IAssetRegistry& AssetRegistry =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TSet<FName> RegistryPackages;
+
+	AssetRegistry.EnumerateAllAssets([&RegistryPackages](const FAssetData& AssetData)
+	{
+		RegistryPackages.Add(AssetData.PackageName);
+		return true;
+	}, true);
+
+	TArray<FName> PackagesToCheck = RegistryPackages.Array();
+
+	TArray<int64> TimeStamps;
+	TArray<uint64> PackageHashes;
+	TimeStamps.SetNumZeroed(PackagesToCheck.Num());
+	PackageHashes.SetNumZeroed(PackagesToCheck.Num());
+
+	// File stats dominate, spread them over the task graph
+	ParallelFor(PackagesToCheck.Num(), [&](int32 Index)
+	{
+		ReadPackageKey(AssetRegistry, PackagesToCheck[Index], TimeStamps[Index], PackageHashes[Index]);
+	});
+
+	FWriteScopeLock WriteLock(IndexLock);
+
+	for (int32 Index = 0; Index < PackagesToCheck.Num(); ++Index)
+	{
+		const int32* NodeIndex = PackageToNodeIndex.Find(PackagesToCheck[Index]);
+
+		if (!NodeIndex || !Nodes[*NodeIndex].bExists ||
+			Nodes[*NodeIndex].TimeStamp != TimeStamps[Index] ||
+			Nodes[*NodeIndex].PackageHash != PackageHashes[Index])
+		{
+			DirtyPackages.Add(PackagesToCheck[Index]);
+		}
+	}
+
+	// Cached packages that are gone from disk
+	for (const FPackageNode& Node : Nodes)
+	{
+		if (Node.bExists && !RegistryPackages.Contains(Node.PackageName))
+		{
+			DirtyPackages.Add(Node.PackageName);
+		}
+	}
+
+	RelinkDirtyPackages();
+
+	bLoadedFromCache = false;
+}
+
+void FSuperManagerReferenceIndex::ReadPackageKey(
+	IAssetRegistry& AssetRegistry, FName PackageName, int64& OutTimeStamp, uint64& OutPackageHash)
+{
+	OutTimeStamp = 0;
+	OutPackageHash = 0;
+
+	const FString PackageNameString = PackageName.ToString();
+	FString PackageFilename;
+
+	if (FPackageName::TryConvertLongPackageNameToFilename(PackageNameString, PackageFilename))
+	{
+		FFileStatData StatData = IFileManager::Get().GetStatData(*(PackageFilename + FPackageName::GetAssetPackageExtension()));
+
+		if (!StatData.bIsValid)
+		{
+			StatData = IFileManager::Get().GetStatData(*(PackageFilename + FPackageName::GetMapPackageExtension()));
+		}
+
+		if (StatData.bIsValid)
+		{
+			OutTimeStamp = StatData.ModificationTime.GetTicks();
+		}
+	}
+
+	if (TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName))
+	{
+		OutPackageHash = CityHash64WithSeed(
+			reinterpret_cast<const char*>(PackageData->PackageSavedHash.GetBytes()),
+			sizeof(FIoHash::ByteArray), PackageData->DiskSize);
+	}
+}
+
+void FSuperManagerReferenceIndex::RefreshPackageKeys(IAssetRegistry& AssetRegistry, const TArray<int32>& NodeIndices)
+{
+	ParallelFor(NodeIndices.Num(), [&](int32 Index)
+	{
+		FPackageNode& Node = Nodes[NodeIndices[Index]];
+		ReadPackageKey(AssetRegistry, Node.PackageName, Node.TimeStamp, Node.PackageHash);
+	});
+}
+
+#pragma endregion
+
+int32 FSuperManagerReferenceIndex::FindOrAddNode(FName PackageName)
+{
+	if (const int32* ExistingIndex = PackageToNodeIndex.Find(PackageName))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NewIndex = Nodes.AddDefaulted();
+	Nodes[NewIndex].PackageName = PackageName;
+	PackageToNodeIndex.Add(PackageName, NewIndex);
+
+	return NewIndex;
+}
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerRootSet.h"
+#include "Settings/SuperManagerSettings.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "GameMapsSettings.h"
+#include "Settings/ProjectPackagingSettings.h"
+#include "Engine/PrimaryAssetLabel.h"
+#include "Engine/World.h"
+
+namespace SuperManagerRootSet
+{
+	static void AddObjectPathRoot(const FString& ObjectPath, TArray<FName>& OutRootPackages)
+	{
+		if (ObjectPath.IsEmpty()) return;
+
+		OutRootPackages.Add(FName(*FPackageName::ObjectPathToPackageName(ObjectPath)));
+	}
+
+	static void AddRootsFromFilter(IAssetRegistry& AssetRegistry, const FARFilter& Filter, TArray<FName>& OutRootPackages)
+	{
+		AssetRegistry.EnumerateAssets(Filter, [&OutRootPackages](const FAssetData& AssetData)
+		{
+			OutRootPackages.Add(AssetData.PackageName);
+			return true;
+		});
+	}
+
+	static void AddPrimaryAssetLabelRoots(IAssetRegistry& AssetRegistry, TArray<FName>& OutRootPackages)
+	{
+		FARFilter Filter;
+		Filter.bRecursiveClasses = true;
+		Filter.ClassNames.Add(UPrimaryAssetLabel::StaticClass()->GetFName());
+
+		TArray<FAssetData> Labels;
+		AssetRegistry.GetAssets(Filter, Labels);
+
+		TArray<FAssetIdentifier> ManagedAssets;
+
+		for (const FAssetData& Label : Labels)
+		{
+			OutRootPackages.Add(Label.PackageName);
+
+			// A label reaches what it labels through Manage edges, the reference index only holds Package edges
+			ManagedAssets.Reset();
+
+			const FPrimaryAssetId PrimaryAssetId = Label.GetPrimaryAssetId();
+
+			if (PrimaryAssetId.IsValid())
+			{
+				AssetRegistry.GetDependencies(FAssetIdentifier(PrimaryAssetId), ManagedAssets, UE::AssetRegistry::EDependencyCategory::Manage);
+			}
+
+			AssetRegistry.GetDependencies(FAssetIdentifier(Label.PackageName), ManagedAssets, UE::AssetRegistry::EDependencyCategory::Manage);
+
+			for (const FAssetIdentifier& ManagedAsset : ManagedAssets)
+			{
+				if (!ManagedAsset.PackageName.IsNone())
+				{
+					OutRootPackages.Add(ManagedAsset.PackageName);
+				}
+			}
+		}
+	}
+
+	static void AddRootsUnderPath(IAssetRegistry& AssetRegistry, const FString& PackagePath, TArray<FName>& OutRootPackages)
+	{
+		if (PackagePath.IsEmpty()) return;
+
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Emplace(*PackagePath);
+
+		AddRootsFromFilter(AssetRegistry, Filter, OutRootPackages);
+	}
+
+	void GatherRootPackages(TArray<FName>& OutRootPackages)
+	{
+		OutRootPackages.Reset();
+
+		const USuperManagerSettings* Settings = USuperManagerSettings::Get();
+
+		IAssetRegistry& AssetRegistry =
+			FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+		if (Settings->bMapsAreRoots)
+		{
+			FARFilter Filter;
+			Filter.bRecursiveClasses = true;
+			Filter.ClassNames.Add(UWorld::StaticClass()->GetFName());
+
+			AddRootsFromFilter(AssetRegistry, Filter, OutRootPackages);
+		}
+
+		if (Settings->bGameModeClassesAreRoots)
+		{
+			const UGameMapsSettings* GameMapsSettings = GetDefault<UGameMapsSettings>();
+
+			AddObjectPathRoot(UGameMapsSettings::GetGameDefaultMap(), OutRootPackages);
+			AddObjectPathRoot(UGameMapsSettings::GetGlobalDefaultGameMode(), OutRootPackages);
+			AddObjectPathRoot(UGameMapsSettings::GetGlobalDefaultServerGameMode(), OutRootPackages);
+			AddObjectPathRoot(GameMapsSettings->EditorStartupMap.ToString(), OutRootPackages);
+			AddObjectPathRoot(GameMapsSettings->TransitionMap.ToString(), OutRootPackages);
+			AddObjectPathRoot(GameMapsSettings->GameInstanceClass.ToString(), OutRootPackages);
+		}
+
+		if (Settings->bPrimaryAssetLabelsAreRoots)
+		{
+			AddPrimaryAssetLabelRoots(AssetRegistry, OutRootPackages);
+		}
+
+		if (Settings->bAlwaysCookDirectoriesAreRoots)
+		{
+			for (const FDirectoryPath& Directory : GetDefault<UProjectPackagingSettings>()->DirectoriesToAlwaysCook)
+			{
+				AddRootsUnderPath(AssetRegistry, Directory.Path, OutRootPackages);
+			}
+		}
+
+		for (const FDirectoryPath& Directory : Settings->AdditionalRootDirectories)
+		{
+			AddRootsUnderPath(AssetRegistry, Directory.Path, OutRootPackages);
+		}
+
+		for (const FSoftObjectPath& RootAsset : Settings->AdditionalRootAssets)
+		{
+			AddObjectPathRoot(RootAsset.ToString(), OutRootPackages);
+		}
+	}
+}
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AssetIndex/SuperManagerBenchmark.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "SuperManager.h"
+
+/**
+ * SuperManager.BenchmarkScan [PackagePath]
+ * Runs the folder gathering, unused and same-name classification passes over every asset under
+ * PackagePath (default /Game) with 1, 4, 16 and 32 workers and logs the throughput of each.
+ */
+namespace SuperManagerScanBenchmark
+{
+	static const int32 WorkerCounts[] = { 1, 4, 16, 32 };
+
+	static int32 RunPasses(const TArray<TSharedPtr<FAssetData>>& AssetsData, int32 NumWorkers)
+	{
+		const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		const FSuperManagerReferenceIndex& Index =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager")).GetReferenceIndex();
+
+		// Folder gathering : one registry lookup per object path
+		TArray<TSharedPtr<FAssetData>> GatheredAssetsData;
+		SuperManagerParallel::ParallelGather(AssetsData.Num(), NumWorkers, GatheredAssetsData,
+			[&](int32 AssetIndex, TArray<TSharedPtr<FAssetData>>& ChunkAssetsData)
+			{
+				const FAssetData Data = AssetRegistry.GetAssetByObjectPath(AssetsData[AssetIndex]->GetSoftObjectPath(), true);
+
+				if (Data.IsValid())
+				{
+					ChunkAssetsData.Add(MakeShared<FAssetData>(Data));
+				}
+			});
+
+		// Unused classification
+		TArray<TSharedPtr<FAssetData>> UnusedAssetsData;
+		SuperManagerParallel::ParallelFilter(AssetsData, UnusedAssetsData, NumWorkers,
+			[&Index](const TSharedPtr<FAssetData>& Data)
+			{
+				return Index.IsPackageUnused(Data->PackageName);
+			});
+
+		// Same-name key extraction
+		TArray<FString> AssetNames;
+		SuperManagerParallel::ParallelGather(AssetsData.Num(), NumWorkers, AssetNames,
+			[&AssetsData](int32 AssetIndex, TArray<FString>& ChunkNames)
+			{
+				ChunkNames.Add(AssetsData[AssetIndex]->AssetName.ToString());
+			});
+
+		return UnusedAssetsData.Num();
+	}
+
+	static void Run(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args)
+	{
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Emplace(*FSuperManagerBenchmark::GetPackagePathArgument(Args));
+
+		TArray<FAssetData> RegistryAssetsData;
+		IAssetRegistry::GetChecked().GetAssets(Filter, RegistryAssetsData);
+
+		TArray<TSharedPtr<FAssetData>> AssetsData;
+		AssetsData.Reserve(RegistryAssetsData.Num());
+
+		for (const FAssetData& Data : RegistryAssetsData)
+		{
+			AssetsData.Add(MakeShared<FAssetData>(Data));
+		}
+
+		if (AssetsData.Num() == 0)
+		{
+			Benchmark.LogMessage(TEXT("no assets under ") + Filter.PackagePaths[0].ToString());
+			return;
+		}
+
+		double SerialSeconds = 0.0;
+
+		for (const int32 NumWorkers : WorkerCounts)
+		{
+			int32 NumUnused = 0;
+
+			const double Seconds = FSuperManagerBenchmark::TimePass([&AssetsData, NumWorkers]()
+			{
+				return RunPasses(AssetsData, NumWorkers);
+			}, NumUnused);
+
+			if (NumWorkers == 1)
+			{
+				SerialSeconds = Seconds;
+			}
+
+			Benchmark.LogResult(*FString::Printf(TEXT("%d workers"), NumWorkers), FString::Printf(
+				TEXT("%d assets, %.2f ms, %.0f assets/s, x%.2f"),
+				AssetsData.Num(), Seconds * 1000.0, AssetsData.Num() / FMath::Max(Seconds, 1e-9),
+				SerialSeconds / FMath::Max(Seconds, 1e-9)));
+		}
+	}
+
+	static FSuperManagerBenchmark BenchmarkScan(
+		TEXT("SuperManager.BenchmarkScan"),
+		TEXT("Measure SuperManager scan throughput at 1, 4, 16 and 32 workers. Optional argument : package path"),
+		&Run);
+}
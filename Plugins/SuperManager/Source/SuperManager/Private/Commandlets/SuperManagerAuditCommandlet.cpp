@@ -0,0 +1,275 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Commandlets/SuperManagerAuditCommandlet.h"
+#include "SuperManager.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetIndex/SuperManagerFolderTree.h"
+#include "AssetIndex/SuperManagerRedirectorAudit.h"
+#include "AssetIndex/SuperManagerParallel.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSuperManagerAudit, Log, All);
+
+namespace SuperManagerAudit
+{
+	/** Rows are written as they are found, nothing is kept in memory */
+	class FReportWriter
+	{
+	public:
+		bool Open(const FString& Filename)
+		{
+			bCsv = FPaths::GetExtension(Filename).Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+
+			Archive.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+			if (!Archive.IsValid()) return false;
+
+			Write(bCsv ? TEXT("Category,Path,Class,Detail\n") : TEXT("[\n"));
+			return true;
+		}
+
+		void AddRow(const TCHAR* Category, const FString& Path, const FString& ClassName, const FString& Detail = FString())
+		{
+			if (bCsv)
+			{
+				Write(FString::Printf(TEXT("%s,%s,%s,%s\n"), Category, *EscapeCsv(Path), *EscapeCsv(ClassName), *EscapeCsv(Detail)));
+			}
+			else
+			{
+				Write(FString::Printf(TEXT("%s\t{ \"category\": \"%s\", \"path\": \"%s\", \"class\": \"%s\", \"detail\": \"%s\" }"),
+					NumRows > 0 ? TEXT(",\n") : TEXT(""), Category, *EscapeJson(Path), *EscapeJson(ClassName), *EscapeJson(Detail)));
+			}
+
+			++NumRows;
+		}
+
+		void Close()
+		{
+			if (!Archive.IsValid()) return;
+
+			if (!bCsv)
+			{
+				Write(TEXT("\n]\n"));
+			}
+
+			Archive->Close();
+			Archive.Reset();
+		}
+
+		int32 GetNumRows() const { return NumRows; }
+
+	private:
+		void Write(const FString& Text)
+		{
+			FTCHARToUTF8 Utf8Text(*Text);
+			Archive->Serialize(const_cast<ANSICHAR*>(Utf8Text.Get()), Utf8Text.Length());
+		}
+
+		static FString EscapeJson(const FString& Text)
+		{
+			FString Escaped;
+			Escaped.Reserve(Text.Len());
+
+			for (const TCHAR Character : Text)
+			{
+				if (Character == TEXT('\\') || Character == TEXT('"'))
+				{
+					Escaped.AppendChar(TEXT('\\'));
+					Escaped.AppendChar(Character);
+				}
+				else if (static_cast<uint32>(Character) < 0x20)
+				{
+					// Control characters are not allowed raw in a JSON string
+					Escaped += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Character));
+				}
+				else
+				{
+					Escaped.AppendChar(Character);
+				}
+			}
+
+			return Escaped;
+		}
+
+		static FString EscapeCsv(const FString& Text)
+		{
+			if (!Text.Contains(TEXT(",")) && !Text.Contains(TEXT("\""))) return Text;
+
+			return TEXT("\"") + Text.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+		}
+
+		TUniquePtr<FArchive> Archive;
+		bool bCsv = false;
+		int32 NumRows = 0;
+	};
+
+	static bool HasCheck(const FString& Checks, const TCHAR* CheckName)
+	{
+		TArray<FString> CheckNames;
+		Checks.ParseIntoArray(CheckNames, TEXT(","));
+
+		return CheckNames.ContainsByPredicate([CheckName](const FString& Name)
+		{
+			return Name.TrimStartAndEnd().Equals(CheckName, ESearchCase::IgnoreCase);
+		});
+	}
+}
+
+USuperManagerAuditCommandlet::USuperManagerAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USuperManagerAuditCommandlet::Main(const FString& Params)
+{
+	FString FolderPath = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Path="), FolderPath);
+
+	FString ReportFilename = FPaths::ProjectSavedDir() / TEXT("SuperManager") / TEXT("AuditReport.json");
+	FParse::Value(*Params, TEXT("Report="), ReportFilename);
+
+	FString Checks = TEXT("Redirectors,Unused,EmptyFolders,SameName");
+	FParse::Value(*Params, TEXT("Checks="), Checks, false);
+
+	const bool bApply = FParse::Param(*Params, TEXT("Apply"));
+
+	// No editor tick in a commandlet, the registry has to be complete before any check
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	SuperManagerAudit::FReportWriter Report;
+
+	if (!Report.Open(ReportFilename))
+	{
+		UE_LOG(LogSuperManagerAudit, Error, TEXT("Could not open report file %s"), *ReportFilename);
+		return 1;
+	}
+
+	// First, so -Apply fixes references before unused assets are looked for
+	if (SuperManagerAudit::HasCheck(Checks, TEXT("Redirectors")))
+	{
+		TArray<FSuperManagerRedirectorChain> RedirectorChains;
+		SuperManagerRedirectorAudit::BuildRedirectorChains({ FolderPath }, RedirectorChains);
+
+		for (const FSuperManagerRedirectorChain& Chain : RedirectorChains)
+		{
+			const FString Detail = Chain.bCycle
+				? FString::Printf(TEXT("cycle after %d redirectors, %d referencers"), Chain.GetChainLength(), Chain.NumReferencers)
+				: FString::Printf(TEXT("-> %s, chain of %d, %d referencers"),
+					*Chain.FinalTarget.ToString(), Chain.GetChainLength(), Chain.NumReferencers);
+
+			Report.AddRow(TEXT("Redirector"), Chain.Redirector.ToString(), TEXT("ObjectRedirector"), Detail);
+		}
+
+		UE_LOG(LogSuperManagerAudit, Display, TEXT("%s under %s"),
+			*SuperManagerRedirectorAudit::DescribeChains(RedirectorChains), *FolderPath);
+
+		if (bApply && RedirectorChains.Num() > 0)
+		{
+			const int32 NumFixed = SuperManagerRedirectorAudit::FixRedirectorChains(RedirectorChains, false);
+			UE_LOG(LogSuperManagerAudit, Display, TEXT("Fixed up %d redirectors"), NumFixed);
+		}
+	}
+
+	if (SuperManagerAudit::HasCheck(Checks, TEXT("Unused")))
+	{
+		// One registry query for the folder, excluded paths already dropped
+		TArray<FAssetData> AssetsData;
+		SuperManagerModule.GatherAssetsUnderFolders({ FolderPath }, AssetsData);
+
+		TArray<FAssetData> UnusedAssetsData;
+		SuperManagerModule.FindUnusedAssets(AssetsData, UnusedAssetsData);
+
+		for (const FAssetData& UnusedAssetData : UnusedAssetsData)
+		{
+			Report.AddRow(TEXT("UnusedAsset"), UnusedAssetData.GetSoftObjectPath().ToString(), UnusedAssetData.AssetClass.ToString());
+		}
+
+		UE_LOG(LogSuperManagerAudit, Display, TEXT("%d unused assets under %s"), UnusedAssetsData.Num(), *FolderPath);
+
+		if (bApply && UnusedAssetsData.Num() > 0)
+		{
+			const int32 NumDeleted = SuperManagerModule.DeleteAssetsWithoutLoading(UnusedAssetsData, false);
+			UE_LOG(LogSuperManagerAudit, Display, TEXT("Deleted %d unused assets"), NumDeleted);
+		}
+	}
+
+	if (SuperManagerAudit::HasCheck(Checks, TEXT("SameName")))
+	{
+		const TSharedRef<FSuperManagerAssetTable> AssetTable = SuperManagerModule.BuildAssetTableUnderFolders({ FolderPath });
+
+		TArray<FSuperManagerAssetRowId> AllRows;
+		AssetTable->GetAllRows(AllRows);
+
+		TArray<FSuperManagerAssetRowId> SameNameRows;
+		SuperManagerModule.ListSameNameAssetsForAssetList(*AssetTable, AllRows, SameNameRows);
+
+		for (const FSuperManagerAssetRowId& SameNameRow : SameNameRows)
+		{
+			Report.AddRow(TEXT("SameNameAsset"), AssetTable->GetObjectPath(SameNameRow).ToString(), AssetTable->GetClassName(SameNameRow).ToString());
+		}
+
+		UE_LOG(LogSuperManagerAudit, Display, TEXT("%d assets share a name under %s"), SameNameRows.Num(), *FolderPath);
+	}
+
+	if (SuperManagerAudit::HasCheck(Checks, TEXT("ContentDuplicates")))
+	{
+		const TSharedRef<FSuperManagerAssetTable> AssetTable = SuperManagerModule.BuildAssetTableUnderFolders({ FolderPath });
+
+		TArray<FSuperManagerAssetRowId> AllRows;
+		AssetTable->GetAllRows(AllRows);
+
+		// Only packages changed since the last run are read, the cache is saved when the module shuts down
+		const int32 NumHashed = SuperManagerContentHashes::HashPackages(
+			SuperManagerModule.GetContentHashCache(), *AssetTable, AllRows, SuperManagerParallel::GetNumWorkers());
+
+		TArray<FSuperManagerAssetRowId> DuplicateRows;
+		SuperManagerModule.ListContentDuplicatesForAssetList(*AssetTable, AllRows, DuplicateRows);
+
+		for (const FSuperManagerAssetRowId& DuplicateRow : DuplicateRows)
+		{
+			Report.AddRow(TEXT("ContentDuplicate"), AssetTable->GetObjectPath(DuplicateRow).ToString(), AssetTable->GetClassName(DuplicateRow).ToString());
+		}
+
+		UE_LOG(LogSuperManagerAudit, Display, TEXT("%d assets are copies of another package under %s, %d packages hashed"),
+			DuplicateRows.Num(), *FolderPath, NumHashed);
+	}
+
+	// Last, so folders emptied by -Apply above are reported too
+	if (SuperManagerAudit::HasCheck(Checks, TEXT("EmptyFolders")))
+	{
+		TArray<FString> EmptyFolderPaths;
+		SuperManagerModule.FindEmptyFolders({ FolderPath }, EmptyFolderPaths);
+
+		for (const FString& EmptyFolderPath : EmptyFolderPaths)
+		{
+			Report.AddRow(TEXT("EmptyFolder"), EmptyFolderPath, FString());
+		}
+
+		int32 NumDeleted = 0;
+
+		if (bApply && EmptyFolderPaths.Num() > 0)
+		{
+			TArray<FString> FailedFolderPaths;
+			NumDeleted = SuperManagerFolderTree::DeleteFolders(EmptyFolderPaths, FailedFolderPaths);
+
+			for (const FString& FailedFolderPath : FailedFolderPaths)
+			{
+				UE_LOG(LogSuperManagerAudit, Warning, TEXT("Could not delete folder %s"), *FailedFolderPath);
+			}
+		}
+
+		UE_LOG(LogSuperManagerAudit, Display, TEXT("%d empty folders under %s, %d deleted"),
+			EmptyFolderPaths.Num(), *FolderPath, NumDeleted);
+	}
+
+	Report.Close();
+
+	UE_LOG(LogSuperManagerAudit, Display, TEXT("Wrote %d rows to %s"), Report.GetNumRows(), *ReportFilename);
+
+	return 0;
+}
@@ -5,25 +5,89 @@
 #include "SlateBasics.h"
 #include "DebugHeader.h"
 #include "SuperManager.h"
+#include "AssetIndex/SuperManagerAssetScan.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "AssetIndex/SuperManagerFolderTree.h"
+#include "AssetIndex/SuperManagerPackageSizes.h"
+#include "Widgets/Input/SNumericEntryBox.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Layout/SExpandableArea.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Misc/PackageName.h"
+#include "AssetRegistry/AssetRegistryModule.h"
 
 #define ListAll TEXT("List All Available Assets")
 #define ListUnused TEXT("List Unused Assets")
+#define ListUnreachable TEXT("List Unreachable Assets")
 #define ListSameName TEXT("List Assets with Same Name")
+#define ListContentDuplicates TEXT("List Content Duplicates")
+
+// Matches moved from a background scan into the list per frame
+static const int32 ScanResultsPerFrame = 2048;
+
+namespace AdvanceDeletionColumns
+{
+	static const FName CheckBox(TEXT("CheckBox"));
+	static const FName Name(TEXT("Name"));
+	static const FName Class(TEXT("Class"));
+	static const FName Path(TEXT("Path"));
+	static const FName Size(TEXT("Size"));
+	static const FName Referencers(TEXT("Referencers"));
+	static const FName Modified(TEXT("Modified"));
+	static const FName Delete(TEXT("Delete"));
+}
+
+DECLARE_DELEGATE_RetVal_OneParam(TSharedRef<SWidget>, FOnGenerateAssetCell, const FName& /*ColumnId*/);
+
+// One row of the asset list, the tab builds every cell
+class SAdvanceDeletionAssetRow : public SMultiColumnTableRow<FSuperManagerAssetRowId>
+{
+public:
+	SLATE_BEGIN_ARGS(SAdvanceDeletionAssetRow) {}
+
+	SLATE_EVENT(FOnGenerateAssetCell, OnGenerateCell)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable)
+	{
+		OnGenerateCell = InArgs._OnGenerateCell;
+
+		FSuperRowType::Construct(FSuperRowType::FArguments().Padding(FMargin(5.f)), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		return OnGenerateCell.IsBound() ? OnGenerateCell.Execute(ColumnId) : SNullWidget::NullWidget;
+	}
+
+private:
+	FOnGenerateAssetCell OnGenerateCell;
+};
 
 void SAdvanceDeletionTab::Construct(const FArguments& InArgs)
 {
 	bCanSupportFocus = true;
 
-	StoreAssetsData = InArgs._AssetsDataToStore;
-	DisplayedAssetsData = StoreAssetsData;
+	AssetTable = InArgs._AssetTable.IsValid() ? InArgs._AssetTable : MakeShared<FSuperManagerAssetTable>();
+	SuperManagerFolderTree::CollapseNestedFolders(InArgs._SelectedFolders, FolderPaths);
+	AssetTable->GetAllRows(StoreRows);
+	SourceRows = StoreRows;
+	FilterPipeline.SetSourceRows(*AssetTable, SourceRows);
+	ListedRows = StoreRows;
+	DisplayedRows = ListedRows;
+
+	NameSearch.Build(*AssetTable);
 
-	CheckBoxesArray.Empty();
-	AssetsDataToDeleteArray.Empty();
+	ResetRowState();
 	ComboBoxSourceItems.Empty();
 
 	ComboBoxSourceItems.Add(MakeShared<FString>(ListAll));
 	ComboBoxSourceItems.Add(MakeShared<FString>(ListUnused));
+	ComboBoxSourceItems.Add(MakeShared<FString>(ListUnreachable));
 	ComboBoxSourceItems.Add(MakeShared<FString>(ListSameName));
+	ComboBoxSourceItems.Add(MakeShared<FString>(ListContentDuplicates));
 
 	FSlateFontInfo TitleTextFont = GetEmbossedTextFont();
 	TitleTextFont.Size = 30;
@@ -43,7 +107,7 @@ void SAdvanceDeletionTab::Construct(const FArguments& InArgs)
 			.ColorAndOpacity(FColor::White)
 		]
 
-		// ι° 
+		// 두번째 슬롯
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		[
@@ -70,12 +134,36 @@ void SAdvanceDeletionTab::Construct(const FArguments& InArgs)
 			.FillWidth(.1f)
 			[
 				ConstructComboHelpTexts(
-					TEXT("Current Folder : \n") + InArgs._CurrentSelectedFolder,
+					(FolderPaths.Num() > 1 ? TEXT("Current Folders : \n") : TEXT("Current Folder : \n"))
+						+ FString::Join(FolderPaths, TEXT("\n")),
 					ETextJustify::Right)
 			]
 		]
 
-		// ° 
+		// Filter the listed rows by name or path as you type
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5.f)
+		[
+			ConstructSearchBox()
+		]
+
+		// Filters stacked on top of the listing condition
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5.f)
+		[
+			ConstructFilterBar()
+		]
+
+		// Progress of a running background scan
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			ConstructScanStatusBar()
+		]
+
+		// 세번째 슬롯
 		+ SVerticalBox::Slot()
 		.VAlign(VAlign_Fill)
 		[
@@ -87,7 +175,14 @@ void SAdvanceDeletionTab::Construct(const FArguments& InArgs)
 			]
 		]
 
-		// 4° 
+		// What deleting each folder of the listed rows would free
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			ConstructFolderSizeView()
+		]
+
+		// 4번째 슬롯
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		[
@@ -117,17 +212,38 @@ void SAdvanceDeletionTab::Construct(const FArguments& InArgs)
 				ConstructDeselectAllButton()
 			]
 
+			// Button 04
+			+ SHorizontalBox::Slot()
+			.FillWidth(10.f)
+			.Padding(5.f)
+			[
+				ConstructSortBySizeButton()
+			]
+
 		]
 
 	];
+
+	RegisterLiveUpdates();
+}
+
+SAdvanceDeletionTab::~SAdvanceDeletionTab()
+{
+	UnregisterLiveUpdates();
+
+	if (ActiveScan.IsValid())
+	{
+		ActiveScan->Cancel();
+	}
 }
 
-TSharedRef<SListView<TSharedPtr<FAssetData>>> SAdvanceDeletionTab::ConstructAssetListView()
+TSharedRef<SListView<FSuperManagerAssetRowId>> SAdvanceDeletionTab::ConstructAssetListView()
 {
 	ConstructedAssetListView =
-		SNew(SListView<TSharedPtr<FAssetData>>)
+		SNew(SListView<FSuperManagerAssetRowId>)
 		.ItemHeight(24.f)
-		.ListItemsSource(&DisplayedAssetsData)
+		.ListItemsSource(&DisplayedRows)
+		.HeaderRow(ConstructHeaderRow())
 		.OnGenerateRow(this, &SAdvanceDeletionTab::OnGenerateRowForList)
 		.OnMouseButtonClick(this, &SAdvanceDeletionTab::OnRowWidgetMouseButtonClicked);
 
@@ -136,13 +252,17 @@ TSharedRef<SListView<TSharedPtr<FAssetData>>> SAdvanceDeletionTab::ConstructAsse
 
 void SAdvanceDeletionTab::RefreshAssetListView()
 {
-	CheckBoxesArray.Empty();
-	AssetsDataToDeleteArray.Empty();
+	BuildRowGroups();
+	SortListedRows();
+	ApplySearchFilter();
+	ResetRowState();
 
 	if (ConstructedAssetListView.IsValid())
 	{
 		ConstructedAssetListView->RebuildList();
 	}
+
+	RefreshFolderSizes();
 }
 
 #pragma region ComboBoxForListingCondition
@@ -180,24 +300,41 @@ void SAdvanceDeletionTab::OnComboSelectionChanged(TSharedPtr<FString> SelectedOp
 	FSuperManagerModule& SuperManagerModule =
 		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
 
-	//  ͵鿡   ͸ ϰ 
+	CancelBackgroundScan();
+
+	// 전달한 데이터들에 대해 모듈이 필터링 하게 함
 	if (*SelectedOption.Get() == ListAll)
 	{
 		// List all sotred asset data
-		DisplayedAssetsData = StoreAssetsData;
-		RefreshAssetListView();
+		ListingCondition = EAdvanceDeletionListing::All;
+		SetSourceRows(CopyTemp(StoreRows));
 	}
 	else if (*SelectedOption.Get() == ListUnused)
 	{
-		// List all unused asset data
-		SuperManagerModule.ListUnusedAssetsForAssetList(StoreAssetsData, DisplayedAssetsData);
-		RefreshAssetListView();
+		// List all unused asset data, rows stream in while the scan runs
+		ListingCondition = EAdvanceDeletionListing::Unused;
+		StartBackgroundScan(SuperManagerModule.StartUnusedAssetsScan(AssetTable.ToSharedRef(), StoreRows, true));
+	}
+	else if (*SelectedOption.Get() == ListUnreachable)
+	{
+		// List assets that no map, game mode, label or always cook directory can reach
+		ListingCondition = EAdvanceDeletionListing::Unreachable;
+		StartBackgroundScan(SuperManagerModule.StartUnreachableAssetsScan(AssetTable.ToSharedRef(), StoreRows, true, &ReachableNodes));
 	}
 	else if (*SelectedOption.Get() == ListSameName)
 	{
 		// List out all assets same name
-		SuperManagerModule.ListSameNameAssetsForAssetList(StoreAssetsData, DisplayedAssetsData);
-		RefreshAssetListView();
+		ListingCondition = EAdvanceDeletionListing::SameName;
+
+		TArray<FSuperManagerAssetRowId> SameNameRows;
+		SuperManagerModule.ListSameNameAssetsForAssetList(*AssetTable, StoreRows, SameNameRows);
+		SetSourceRows(MoveTemp(SameNameRows));
+	}
+	else if (*SelectedOption.Get() == ListContentDuplicates)
+	{
+		// List assets whose package is a copy of another one, whatever their names
+		ListingCondition = EAdvanceDeletionListing::ContentDuplicates;
+		StartBackgroundScan(SuperManagerModule.StartContentHashScan(AssetTable.ToSharedRef(), StoreRows));
 	}
 }
 
@@ -215,274 +352,1840 @@ TSharedRef<STextBlock> SAdvanceDeletionTab::ConstructComboHelpTexts(
 
 #pragma endregion
 
-#pragma region RowWidgetForAssetListView
+#pragma region NameSearch
 
-TSharedRef<ITableRow> SAdvanceDeletionTab::OnGenerateRowForList(
-	TSharedPtr<FAssetData> AssetDataToDisplay, const TSharedRef<STableViewBase>& OwnerTable)
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructSearchBox()
 {
-	if (!AssetDataToDisplay.IsValid()) 
-		return SNew(STableRow<TSharedPtr<FAssetData>>, OwnerTable);
+	TSharedRef<SSearchBox> ConstructedSearchBox =
+		SNew(SSearchBox)
+		.HintText(FText::FromString(TEXT("Search name or path")))
+		.OnTextChanged(this, &SAdvanceDeletionTab::OnSearchTextChanged);
 
-	const FString ClassName = AssetDataToDisplay->GetClass()->GetName();
+	return ConstructedSearchBox;
+}
 
-	const FString DisplayAssetClassName = AssetDataToDisplay->AssetClass.ToString();
-	const FString DisplayAssetName = AssetDataToDisplay->AssetName.ToString();
+void SAdvanceDeletionTab::OnSearchTextChanged(const FText& InSearchText)
+{
+	const FString NewSearchText = InSearchText.ToString().TrimStartAndEnd();
+	if (NewSearchText.Equals(SearchText, ESearchCase::IgnoreCase)) return;
 
-	FSlateFontInfo AssetClassNameFont = GetEmbossedTextFont();
-	AssetClassNameFont.Size = 10;
+	// A row containing the longer text also contains the shorter one, only the last matches need checking
+	const bool bNarrowing = !SearchText.IsEmpty() && NewSearchText.Contains(SearchText);
 
-	FSlateFontInfo AssetNameFont = GetEmbossedTextFont();
-	AssetNameFont.Size = 15;
+	TArray<FSuperManagerAssetRowId> NewSearchMatches;
+	NameSearch.Search(NewSearchText, bNarrowing ? &SearchMatches : nullptr, NewSearchMatches);
+
+	SearchText = NewSearchText;
+	SearchMatches = MoveTemp(NewSearchMatches);
+
+	SearchMatchedRows.Init(false, AssetTable->Num());
+
+	for (const FSuperManagerAssetRowId& Row : SearchMatches)
+	{
+		SearchMatchedRows[Row.Index] = true;
+	}
+
+	// The listed rows and their folder sizes stay as they are, only the displayed rows change.
+	// Checked rows still displayed keep their check
+	RedisplayListedRows();
+}
+
+void SAdvanceDeletionTab::ApplySearchFilter()
+{
+	if (SearchText.IsEmpty() && RowGroups.Num() == 0)
+	{
+		DisplayedRows = ListedRows;
+		return;
+	}
+
+	DisplayedRows.Reset();
+
+	// Rows of a group are next to each other, a collapsed group keeps its first displayed row
+	int32 LastGroupIndex = INDEX_NONE;
+
+	for (const FSuperManagerAssetRowId& Row : ListedRows)
+	{
+		if (!PassesSearch(Row)) continue;
+
+		const int32 GroupIndex = GetRowGroup(Row);
+		if (GroupIndex != INDEX_NONE && GroupIndex == LastGroupIndex && IsGroupCollapsed(GroupIndex)) continue;
+
+		LastGroupIndex = GroupIndex;
+		DisplayedRows.Add(Row);
+	}
+}
+
+bool SAdvanceDeletionTab::PassesSearch(FSuperManagerAssetRowId Row) const
+{
+	return SearchText.IsEmpty() || (SearchMatchedRows.IsValidIndex(Row.Index) && SearchMatchedRows[Row.Index]);
+}
 
-	TSharedRef<STableRow<TSharedPtr<FAssetData>>> ListViewRowWidget =
-		SNew(STableRow<TSharedPtr<FAssetData>>, OwnerTable).Padding(FMargin(5.f))
+#pragma endregion
+
+#pragma region FilterPipeline
+
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructFilterBar()
+{
+	TSharedRef<SHorizontalBox> ConstructedFilterBar =
+		SNew(SHorizontalBox)
+
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
 		[
-			//   ߰
-			SNew(SHorizontalBox)
+			ConstructClassFilter()
+		]
 
-			// 1. üũڽ
-			+ SHorizontalBox::Slot()
-			.HAlign(HAlign_Left)
-			.VAlign(VAlign_Center)
-			.FillWidth(0.05f)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
+		[
+			SNew(SCheckBox)
+			.OnCheckStateChanged(this, &SAdvanceDeletionTab::OnUnusedFilterChanged)
 			[
-				ConstructCheckBox(AssetDataToDisplay)
+				SNew(STextBlock)
+				.Text(FText::FromString(TEXT("Unused")))
 			]
-						
-			// 2. ڻ Ŭ ̸
-			+ SHorizontalBox::Slot()
-			.HAlign(HAlign_Center)
-			.VAlign(VAlign_Fill)
-			.FillWidth(0.5f)
+		]
+
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
+		[
+			SNew(SCheckBox)
+			.OnCheckStateChanged(this, &SAdvanceDeletionTab::OnSameNameFilterChanged)
 			[
-				ConstructTextForRowWidget(ClassName, AssetClassNameFont)
+				SNew(STextBlock)
+				.Text(FText::FromString(TEXT("Same Name")))
 			]
-			
-			// 3.   ̸
-			+SHorizontalBox::Slot()
-			.HAlign(HAlign_Left)
-			.VAlign(VAlign_Fill)
+		]
+
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
+		[
+			SNew(SNumericEntryBox<int32>)
+			.MinValue(0)
+			.MinDesiredValueWidth(40.f)
+			.Label()
 			[
-				ConstructTextForRowWidget(DisplayAssetName, AssetNameFont)
-			]	
+				SNumericEntryBox<int32>::BuildLabel(FText::FromString(TEXT("Days untouched")), FLinearColor::White, FLinearColor::Transparent)
+			]
+			.Value(this, &SAdvanceDeletionTab::GetMinAgeDays)
+			.OnValueCommitted(this, &SAdvanceDeletionTab::OnMinAgeCommitted)
+		]
 
-			// 4.  ư
-			+ SHorizontalBox::Slot()
-			.HAlign(HAlign_Right)
-			.VAlign(VAlign_Fill)
-			.FillWidth(0.2f)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
+		[
+			SNew(SNumericEntryBox<float>)
+			.MinValue(0.f)
+			.MinDesiredValueWidth(40.f)
+			.Label()
 			[
-				ConstructButtonForRowWidget(AssetDataToDisplay)
+				SNumericEntryBox<float>::BuildLabel(FText::FromString(TEXT("Min MB")), FLinearColor::White, FLinearColor::Transparent)
 			]
-			
+			.Value(this, &SAdvanceDeletionTab::GetMinSizeMegabytes)
+			.OnValueCommitted(this, &SAdvanceDeletionTab::OnMinSizeCommitted)
+		]
+
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.f)
+		.VAlign(VAlign_Center)
+		.Padding(2.f, 0.f)
+		[
+			SNew(SEditableTextBox)
+			.HintText(FText::FromString(TEXT("Package path wildcard, e.g. /Game/Props/*_Old")))
+			.OnTextCommitted(this, &SAdvanceDeletionTab::OnPathFilterCommitted)
 		];
 
-	return ListViewRowWidget;
+	return ConstructedFilterBar;
 }
 
-void SAdvanceDeletionTab::OnRowWidgetMouseButtonClicked(TSharedPtr<FAssetData> ClickedData)
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructClassFilter()
 {
-	FSuperManagerModule& SuperManagerModule =
-		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+	OnClassFilterOpening();
+
+	TSharedRef<SComboBox<TSharedPtr<int32>>> ConstructedClassFilter =
+		SNew(SComboBox<TSharedPtr<int32>>)
+		.OptionsSource(&ClassFilterItems)
+		.OnComboBoxOpening(this, &SAdvanceDeletionTab::OnClassFilterOpening)
+		.OnGenerateWidget(this, &SAdvanceDeletionTab::OnGenerateClassFilterItem)
+		.OnSelectionChanged(this, &SAdvanceDeletionTab::OnClassFilterChanged)
+		[
+			SNew(STextBlock)
+			.Text(this, &SAdvanceDeletionTab::GetSelectedClassFilterText)
+		];
+
+	return ConstructedClassFilter;
+}
+
+void SAdvanceDeletionTab::OnClassFilterOpening()
+{
+	// Live updates can bring classes the table did not have when the tab opened
+	if (ClassFilterItems.Num() == AssetTable->GetNumClasses() + 1) return;
+
+	ClassFilterItems.Reset();
+	ClassFilterItems.Add(MakeShared<int32>(INDEX_NONE));
+
+	for (int32 ClassIndex = 0; ClassIndex < AssetTable->GetNumClasses(); ++ClassIndex)
+	{
+		ClassFilterItems.Add(MakeShared<int32>(ClassIndex));
+	}
 
+	ClassFilterItems.Sort([this](const TSharedPtr<int32>& A, const TSharedPtr<int32>& B)
+	{
+		if (*A == INDEX_NONE || *B == INDEX_NONE) return *A == INDEX_NONE && *B != INDEX_NONE;
 
-	SuperManagerModule.SyncCBToClickedAssetForAssetList(ClickedData->ObjectPath.ToString());
+		return AssetTable->GetClassNameAt(*A).LexicalLess(AssetTable->GetClassNameAt(*B));
+	});
 }
 
-TSharedRef<SCheckBox> SAdvanceDeletionTab::ConstructCheckBox(const TSharedPtr<FAssetData>& AssetDataToDisplay)
+TSharedRef<SWidget> SAdvanceDeletionTab::OnGenerateClassFilterItem(TSharedPtr<int32> ClassIndex)
 {
-	TSharedRef<SCheckBox> ConstructedCheckBox =
-		SNew(SCheckBox)
-		.Type(ESlateCheckBoxType::CheckBox)
-		.OnCheckStateChanged(this, &SAdvanceDeletionTab::OnCheckBoxStateChanged, AssetDataToDisplay)
-		.Visibility(EVisibility::Visible);
+	return SNew(STextBlock).Text(GetClassFilterText(*ClassIndex));
+}
 
-	CheckBoxesArray.Add(ConstructedCheckBox);
+void SAdvanceDeletionTab::OnClassFilterChanged(TSharedPtr<int32> ClassIndex, ESelectInfo::Type InSelectInfo)
+{
+	if (!ClassIndex.IsValid()) return;
 
-	return ConstructedCheckBox;
+	ClassFilterIndex = *ClassIndex;
+	FilterPipeline.SetClassIndex(ClassFilterIndex);
+	ApplyFilterPipeline();
 }
 
-void SAdvanceDeletionTab::OnCheckBoxStateChanged(ECheckBoxState NewState, TSharedPtr<FAssetData> AssetData)
+FText SAdvanceDeletionTab::GetClassFilterText(int32 ClassIndex) const
 {
-	switch (NewState)
-	{
-	case ECheckBoxState::Unchecked:
-		if (AssetsDataToDeleteArray.Contains(AssetData))
-		{
-			AssetsDataToDeleteArray.Remove(AssetData);
-		}
-		break;
+	return ClassIndex == INDEX_NONE
+		? FText::FromString(TEXT("Any Class"))
+		: FText::FromName(AssetTable->GetClassNameAt(ClassIndex));
+}
 
-	case ECheckBoxState::Checked:
-		AssetsDataToDeleteArray.AddUnique(AssetData);
-		break;
+FText SAdvanceDeletionTab::GetSelectedClassFilterText() const
+{
+	return GetClassFilterText(ClassFilterIndex);
+}
 
-	case ECheckBoxState::Undetermined:
-		break;
+void SAdvanceDeletionTab::OnUnusedFilterChanged(ECheckBoxState NewState)
+{
+	FilterPipeline.SetUnusedOnly(NewState == ECheckBoxState::Checked);
+	ApplyFilterPipeline();
+}
 
-	default:
-		break;
-	}
-	
+void SAdvanceDeletionTab::OnSameNameFilterChanged(ECheckBoxState NewState)
+{
+	FilterPipeline.SetSameNameOnly(NewState == ECheckBoxState::Checked);
+	ApplyFilterPipeline();
 }
 
-TSharedRef<STextBlock> SAdvanceDeletionTab::ConstructTextForRowWidget(const FString& TextContent, const FSlateFontInfo& FontToUse)
+void SAdvanceDeletionTab::OnMinAgeCommitted(int32 NewMinAgeDays, ETextCommit::Type CommitType)
 {
-	TSharedRef<STextBlock> ContstructedTextBlock =
-		SNew(STextBlock)
-		.Text(FText::FromString(TextContent))
-		.Font(FontToUse)
-		.ColorAndOpacity(FColor::White);
+	MinAgeDays = FMath::Max(NewMinAgeDays, 0);
+	FilterPipeline.SetMinAgeDays(MinAgeDays);
+	ApplyFilterPipeline();
+}
 
-	return ContstructedTextBlock;
+void SAdvanceDeletionTab::OnMinSizeCommitted(float NewMinSizeMegabytes, ETextCommit::Type CommitType)
+{
+	MinSizeMegabytes = FMath::Max(NewMinSizeMegabytes, 0.f);
+	FilterPipeline.SetMinSizeBytes(static_cast<int64>(MinSizeMegabytes * 1024.0 * 1024.0));
+	ApplyFilterPipeline();
 }
 
-TSharedRef<SButton> SAdvanceDeletionTab::ConstructButtonForRowWidget(const TSharedPtr<FAssetData>& AssetDataToDisplay)
+void SAdvanceDeletionTab::OnPathFilterCommitted(const FText& NewPathWildcard, ETextCommit::Type CommitType)
 {
-	TSharedRef<SButton> ConstructButton =
-		SNew(SButton)
-		.Text(FText::FromString(TEXT("Delete")))
-		.OnClicked(this, &SAdvanceDeletionTab::OnDeleteButtonClicked, AssetDataToDisplay);
-	
-	return ConstructButton;
+	FilterPipeline.SetPathWildcard(NewPathWildcard.ToString().TrimStartAndEnd());
+	ApplyFilterPipeline();
 }
 
-FReply SAdvanceDeletionTab::OnDeleteButtonClicked(TSharedPtr<FAssetData> ClickedAssetData)
+void SAdvanceDeletionTab::SetSourceRows(TArray<FSuperManagerAssetRowId>&& NewSourceRows)
 {
-	FSuperManagerModule& SuperManagerModule = 
-		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+	SourceRows = MoveTemp(NewSourceRows);
 
-	const bool bAssetDeleted = SuperManagerModule.DeleteSingleAssetForAssetList(*ClickedAssetData.Get());
+	if (FilterPipeline.IsStageEnabled(ESuperManagerFilterStage::Size))
+	{
+		GatherMissingSizes(SourceRows);
+	}
 
-	if (bAssetDeleted)
+	FilterPipeline.SetSourceRows(*AssetTable, SourceRows);
+
+	RebuildListedRows();
+	RefreshAssetListView();
+}
+
+void SAdvanceDeletionTab::ApplyFilterPipeline()
+{
+	if (FilterPipeline.IsStageEnabled(ESuperManagerFilterStage::Size))
 	{
-		// Updating the list source items
-		if (StoreAssetsData.Contains(ClickedAssetData))
+		GatherMissingSizes(SourceRows);
+	}
+
+	if (FilterPipeline.Update(*AssetTable) == 0) return;
+
+	RebuildListedRows();
+
+	// Same listing, narrower or wider : rows still displayed keep their check
+	ResortListedRows();
+	RefreshFolderSizes();
+}
+
+void SAdvanceDeletionTab::RebuildListedRows()
+{
+	ListedRows.Reset();
+
+	for (const FSuperManagerAssetRowId& Row : SourceRows)
+	{
+		if (FilterPipeline.Passes(Row))
 		{
-			StoreAssetsData.Remove(ClickedAssetData);
+			ListedRows.Add(Row);
 		}
+	}
+}
 
-		if(DisplayedAssetsData.Contains(ClickedAssetData))
+void SAdvanceDeletionTab::GatherMissingSizes(const TArray<FSuperManagerAssetRowId>& Rows)
+{
+	// Rows streamed in by a running scan come with their size, and the table is not written while it reads
+	if (ActiveScan.IsValid()) return;
+
+	TArray<FSuperManagerAssetRowId> RowsWithoutSize;
+
+	for (const FSuperManagerAssetRowId& Row : Rows)
+	{
+		if (!AssetTable->HasSize(Row))
 		{
-			DisplayedAssetsData.Remove(ClickedAssetData);
+			RowsWithoutSize.Add(Row);
 		}
-
-		// Refresh the list
-		RefreshAssetListView();
 	}
 
-	return FReply::Handled();
+	if (RowsWithoutSize.Num() > 0)
+	{
+		SuperManagerPackageSizes::GatherPackageSizes(*AssetTable, RowsWithoutSize, SuperManagerParallel::GetNumWorkers());
+	}
 }
 
 #pragma endregion
 
+#pragma region BackgroundScan
 
-#pragma region TabButtons
-
-TSharedRef<SButton> SAdvanceDeletionTab::ConstructDeleteAllButton()
+void SAdvanceDeletionTab::StartBackgroundScan(const TSharedRef<FSuperManagerAssetScan>& Scan)
 {
-	TSharedRef<SButton> DeleteAllButton =
-		SNew(SButton)
-		.ContentPadding(FMargin(5.f))
-		.OnClicked(this, &SAdvanceDeletionTab::OnDeleteAllButtonClicked);
+	ActiveScan = Scan;
 
-	DeleteAllButton->SetContent(ConstructTextForTabButtons(TEXT("Delete All")));
+	HashedRows.Empty();
+	SourceRows.Empty();
+	FilterPipeline.SetSourceRows(*AssetTable, SourceRows);
+	ListedRows.Empty();
+	RefreshAssetListView();
 
-	return DeleteAllButton;
+	ScanTimerHandle = RegisterActiveTimer(0.f,
+		FWidgetActiveTimerDelegate::CreateSP(this, &SAdvanceDeletionTab::TickBackgroundScan));
 }
 
-FReply SAdvanceDeletionTab::OnDeleteAllButtonClicked()
+void SAdvanceDeletionTab::CancelBackgroundScan()
 {
-	if (AssetsDataToDeleteArray.Num() == 0)
+	if (ActiveScan.IsValid())
 	{
-		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, TEXT("No Asset currently selected."));
-		return FReply::Handled();
+		ActiveScan->Cancel();
+		ActiveScan.Reset();
 	}
 
-	// sharedptr ڻ굥ͷ ȯ ,  ο ִ DeleteMutipleAssetsForAssetList() Լ ȣ.
-
-	TArray<FAssetData> AssetDataToDelete;
-
-	for (const auto& Data : AssetsDataToDeleteArray)
+	if (ScanTimerHandle.IsValid())
 	{
-		AssetDataToDelete.Add(*Data.Get());
+		UnRegisterActiveTimer(ScanTimerHandle.ToSharedRef());
+		ScanTimerHandle.Reset();
 	}
+}
 
-	FSuperManagerModule& SuperManagerModule =
-		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+EActiveTimerReturnType SAdvanceDeletionTab::TickBackgroundScan(double InCurrentTime, float InDeltaTime)
+{
+	if (!ActiveScan.IsValid()) return EActiveTimerReturnType::Stop;
 
-	const bool bAssetsDeleted = SuperManagerModule.DeleteMutipleAssetsForAssetList(AssetDataToDelete);
-	if (bAssetsDeleted)
+	if (ListingCondition == EAdvanceDeletionListing::ContentDuplicates)
 	{
-		for (const auto& DeletedData : AssetsDataToDeleteArray)
+		ActiveScan->ConsumeResults(HashedRows, MAX_int32);
+
+		if (ActiveScan->IsComplete())
 		{
-			//   Ʈ
-			if (StoreAssetsData.Contains(DeletedData))
-			{
-				StoreAssetsData.Remove(DeletedData);
-			}
+			ActiveScan.Reset();
+			ScanTimerHandle.Reset();
 
-			if (DisplayedAssetsData.Contains(DeletedData))
-			{
-				DisplayedAssetsData.Remove(DeletedData);
-			}
+			ListContentDuplicates();
+			return EActiveTimerReturnType::Stop;
 		}
-		RefreshAssetListView();
+
+		return EActiveTimerReturnType::Continue;
 	}
 
-	return FReply::Handled();
-}
+	const int32 NumSourceBefore = SourceRows.Num();
+	ActiveScan->ConsumeResults(SourceRows, ScanResultsPerFrame);
 
-TSharedRef<SButton> SAdvanceDeletionTab::ConstructSelectAllButton()
-{
-	TSharedRef<SButton> SelectAllButton =
-		SNew(SButton)
-		.ContentPadding(FMargin(5.f))
-		.OnClicked(this, &SAdvanceDeletionTab::OnSelectedAllButtonClicked);
+	// Sizes of streamed rows are read by the scan, every stage can judge them right away
+	const TArray<FSuperManagerAssetRowId> NewSourceRows(SourceRows.GetData() + NumSourceBefore, SourceRows.Num() - NumSourceBefore);
+	FilterPipeline.UpdateRows(*AssetTable, NewSourceRows, true);
 
-	SelectAllButton->SetContent(ConstructTextForTabButtons(TEXT("Select All")));
+	const int32 NumDisplayedBefore = DisplayedRows.Num();
 
-	return SelectAllButton;
-}
+	for (const FSuperManagerAssetRowId& Row : NewSourceRows)
+	{
+		if (!FilterPipeline.Passes(Row)) continue;
 
-FReply SAdvanceDeletionTab::OnSelectedAllButtonClicked()
-{
-	if (CheckBoxesArray.Num() == 0) return FReply::Handled();
+		ListedRows.Add(Row);
+
+		if (PassesSearch(Row))
+		{
+			DisplayedRows.Add(Row);
+		}
+	}
+
+	AppendRowState(NumDisplayedBefore);
 
-	for (const auto& CheckBox : CheckBoxesArray)
+	// Only add the new rows, rows already checked by the user keep their state
+	if (DisplayedRows.Num() != NumDisplayedBefore && ConstructedAssetListView.IsValid())
 	{
-		if(!CheckBox->IsChecked())
-			CheckBox->ToggleCheckedState();
+		ConstructedAssetListView->RequestListRefresh();
 	}
 
-	return FReply::Handled();
-}
+	if (ActiveScan->IsComplete())
+	{
+		ActiveScan.Reset();
+		ScanTimerHandle.Reset();
 
-TSharedRef<SButton> SAdvanceDeletionTab::ConstructDeselectAllButton()
-{
-	TSharedRef<SButton> DeselectAllButton =
-		SNew(SButton)
-		.ContentPadding(FMargin(5.f))
-		.OnClicked(this, &SAdvanceDeletionTab::OnDeselectAllButtonClicked);
+		// Streamed rows were appended as found
+		if (PrimarySortMode != EColumnSortMode::None)
+		{
+			ResortListedRows();
+		}
 
-	DeselectAllButton->SetContent(ConstructTextForTabButtons(TEXT("Deselect All")));
+		RefreshFolderSizes();
+		return EActiveTimerReturnType::Stop;
+	}
 
-	return DeselectAllButton;
+	return EActiveTimerReturnType::Continue;
 }
 
-FReply SAdvanceDeletionTab::OnDeselectAllButtonClicked()
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructScanStatusBar()
 {
-	if (CheckBoxesArray.Num() == 0) return FReply::Handled();
+	TSharedRef<SHorizontalBox> ConstructedStatusBar =
+		SNew(SHorizontalBox)
+		.Visibility(this, &SAdvanceDeletionTab::GetScanStatusVisibility)
+
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.f)
+		.VAlign(VAlign_Center)
+		.Padding(5.f)
+		[
+			SNew(SProgressBar)
+			.Percent(this, &SAdvanceDeletionTab::GetScanProgress)
+		]
 
-	for (const auto& CheckBox : CheckBoxesArray)
-	{
-		if (CheckBox->IsChecked())
-			CheckBox->ToggleCheckedState();
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(5.f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SAdvanceDeletionTab::GetScanStatusText)
+		]
+
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(5.f)
+		[
+			SNew(SButton)
+			.Text(FText::FromString(TEXT("Cancel")))
+			.OnClicked(this, &SAdvanceDeletionTab::OnCancelScanButtonClicked)
+		];
+
+	return ConstructedStatusBar;
+}
+
+FReply SAdvanceDeletionTab::OnCancelScanButtonClicked()
+{
+	// Copies among the packages hashed so far
+	if (ListingCondition == EAdvanceDeletionListing::ContentDuplicates && ActiveScan.IsValid())
+	{
+		ActiveScan->Cancel();
+		ActiveScan->ConsumeResults(HashedRows, MAX_int32);
+		CancelBackgroundScan();
+
+		ListContentDuplicates();
+		return FReply::Handled();
+	}
+
+	// Rows found so far stay in the list
+	CancelBackgroundScan();
+	RefreshFolderSizes();
+
+	return FReply::Handled();
+}
+
+void SAdvanceDeletionTab::ListContentDuplicates()
+{
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	// The scan hashed one row per package, every asset of those packages is a candidate
+	TSet<FName> HashedPackages;
+
+	for (const FSuperManagerAssetRowId& HashedRow : HashedRows)
+	{
+		HashedPackages.Add(AssetTable->GetPackageName(HashedRow));
+	}
+
+	TArray<FSuperManagerAssetRowId> RowsOfHashedPackages;
+
+	for (const FSuperManagerAssetRowId& Row : StoreRows)
+	{
+		if (HashedPackages.Contains(AssetTable->GetPackageName(Row)))
+		{
+			RowsOfHashedPackages.Add(Row);
+		}
+	}
+
+	TArray<FSuperManagerAssetRowId> DuplicateRows;
+	SuperManagerModule.ListContentDuplicatesForAssetList(*AssetTable, RowsOfHashedPackages, DuplicateRows);
+	HashedRows.Empty();
+
+	SetSourceRows(MoveTemp(DuplicateRows));
+}
+
+TOptional<float> SAdvanceDeletionTab::GetScanProgress() const
+{
+	return ActiveScan.IsValid() ? ActiveScan->GetProgress() : 1.f;
+}
+
+FText SAdvanceDeletionTab::GetScanStatusText() const
+{
+	if (ListingCondition == EAdvanceDeletionListing::ContentDuplicates)
+	{
+		return FText::FromString(TEXT("Hashing... ") + FString::FromInt(HashedRows.Num()) + TEXT(" packages read"));
+	}
+
+	return FText::FromString(TEXT("Scanning... ") + FString::FromInt(ListedRows.Num()) + TEXT(" found"));
+}
+
+EVisibility SAdvanceDeletionTab::GetScanStatusVisibility() const
+{
+	return ActiveScan.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+#pragma endregion
+
+#pragma region ReclaimableSize
+
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructFolderSizeView()
+{
+	TSharedRef<SExpandableArea> ConstructedFolderSizeView =
+		SNew(SExpandableArea)
+		.InitiallyCollapsed(true)
+		.AreaTitle(FText::FromString(TEXT("Reclaimable Size by Folder")))
+		.BodyContent()
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(200.f)
+			[
+				SAssignNew(FolderSizeListView, SListView<TSharedPtr<FSuperManagerFolderSize>>)
+				.ItemHeight(20.f)
+				.ListItemsSource(&FolderSizes)
+				.OnGenerateRow(this, &SAdvanceDeletionTab::OnGenerateRowForFolderSize)
+			]
+		];
+
+	return ConstructedFolderSizeView;
+}
+
+TSharedRef<ITableRow> SAdvanceDeletionTab::OnGenerateRowForFolderSize(
+	TSharedPtr<FSuperManagerFolderSize> FolderSize, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	if (!FolderSize.IsValid())
+		return SNew(STableRow<TSharedPtr<FSuperManagerFolderSize>>, OwnerTable);
+
+	FSlateFontInfo FolderSizeFont = GetEmbossedTextFont();
+	FolderSizeFont.Size = 10;
+
+	TSharedRef<STableRow<TSharedPtr<FSuperManagerFolderSize>>> FolderSizeRowWidget =
+		SNew(STableRow<TSharedPtr<FSuperManagerFolderSize>>, OwnerTable).Padding(FMargin(2.f))
+		[
+			SNew(SHorizontalBox)
+
+			// Folder path
+			+ SHorizontalBox::Slot()
+			.FillWidth(0.6f)
+			[
+				ConstructTextForRowWidget(FolderSize->FolderPath, FolderSizeFont)
+			]
+
+			// Package count
+			+ SHorizontalBox::Slot()
+			.FillWidth(0.1f)
+			[
+				ConstructTextForRowWidget(FString::FromInt(FolderSize->NumPackages) + TEXT(" packages"), FolderSizeFont)
+			]
+
+			// Disk and cooked bytes freed
+			+ SHorizontalBox::Slot()
+			.FillWidth(0.3f)
+			[
+				ConstructTextForRowWidget(FString::Printf(TEXT("%s (~%s cooked)"),
+					*FText::AsMemory(FolderSize->Size.DiskBytes).ToString(),
+					*FText::AsMemory(FolderSize->Size.EstimatedCookedBytes).ToString()), FolderSizeFont)
+			]
+		];
+
+	return FolderSizeRowWidget;
+}
+
+void SAdvanceDeletionTab::RefreshFolderSizes()
+{
+	// Only packages whose size is known are rolled up. Every listed row counts, whatever the search
+	SuperManagerPackageSizes::RollUpByFolder(*AssetTable, ListedRows, FolderSizes);
+
+	if (FolderSizeListView.IsValid())
+	{
+		FolderSizeListView->RequestListRefresh();
+	}
+}
+
+FString SAdvanceDeletionTab::GetPackageSizeText(FSuperManagerAssetRowId Row) const
+{
+	if (!AssetTable->HasSize(Row)) return FString();
+
+	const FSuperManagerPackageSize PackageSize = AssetTable->GetSize(Row);
+
+	return FString::Printf(TEXT("%s (~%s cooked)"),
+		*FText::AsMemory(PackageSize.DiskBytes).ToString(),
+		*FText::AsMemory(PackageSize.EstimatedCookedBytes).ToString());
+}
+
+TSharedRef<SButton> SAdvanceDeletionTab::ConstructSortBySizeButton()
+{
+	TSharedRef<SButton> SortBySizeButton =
+		SNew(SButton)
+		.ContentPadding(FMargin(5.f))
+		.OnClicked(this, &SAdvanceDeletionTab::OnSortBySizeButtonClicked);
+
+	SortBySizeButton->SetContent(ConstructTextForTabButtons(TEXT("Sort by Size")));
+
+	return SortBySizeButton;
+}
+
+FReply SAdvanceDeletionTab::OnSortBySizeButtonClicked()
+{
+	// Same as a descending click on the size column, without a secondary column
+	SecondarySortColumn = NAME_None;
+	SecondarySortMode = EColumnSortMode::None;
+
+	OnColumnSortModeChanged(EColumnSortPriority::Primary, AdvanceDeletionColumns::Size, EColumnSortMode::Descending);
+
+	return FReply::Handled();
+}
+
+#pragma endregion
+
+#pragma region NameGroups
+
+void SAdvanceDeletionTab::BuildRowGroups()
+{
+	RowGroups.Reset();
+	GroupOfRow.Reset();
+	GroupContentHashes.Reset();
+
+	if (!IsGroupingRows()) return;
+
+	TArray<FSuperManagerAssetRowId> GroupedRows;
+
+	if (ListingCondition == EAdvanceDeletionListing::ContentDuplicates)
+	{
+		const FSuperManagerContentHashCache& ContentHashCache =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager")).GetContentHashCache();
+
+		SuperManagerNameGroups::GroupRowsByKey<FSuperManagerContentHash>(*AssetTable, ListedRows, 1,
+			[this, &ContentHashCache](const FSuperManagerAssetRowId& Row)
+			{
+				return ContentHashCache.FindContentHash(AssetTable->GetPackageName(Row));
+			}, GroupedRows, RowGroups);
+
+		ListedRows = MoveTemp(GroupedRows);
+
+		for (const FSuperManagerRowGroup& Group : RowGroups)
+		{
+			GroupContentHashes.Add(ContentHashCache.FindContentHash(AssetTable->GetPackageName(ListedRows[Group.FirstRow])));
+		}
+	}
+	else
+	{
+		SuperManagerNameGroups::GroupRowsByName(*AssetTable, ListedRows, 1, GroupedRows, RowGroups);
+		ListedRows = MoveTemp(GroupedRows);
+	}
+
+	GroupOfRow.Init(INDEX_NONE, AssetTable->Num());
+
+	for (int32 GroupIndex = 0; GroupIndex < RowGroups.Num(); ++GroupIndex)
+	{
+		const FSuperManagerRowGroup& Group = RowGroups[GroupIndex];
+
+		for (int32 ListedIndex = Group.FirstRow; ListedIndex < Group.FirstRow + Group.NumRows; ++ListedIndex)
+		{
+			GroupOfRow[ListedRows[ListedIndex].Index] = GroupIndex;
+		}
+	}
+}
+
+int32 SAdvanceDeletionTab::GetRowGroup(FSuperManagerAssetRowId Row) const
+{
+	return GroupOfRow.IsValidIndex(Row.Index) ? GroupOfRow[Row.Index] : INDEX_NONE;
+}
+
+bool SAdvanceDeletionTab::IsGroupCollapsed(int32 GroupIndex) const
+{
+	if (GroupContentHashes.IsValidIndex(GroupIndex))
+	{
+		return CollapsedContentHashes.Contains(GroupContentHashes[GroupIndex].Hash);
+	}
+
+	return CollapsedGroupNames.Contains(RowGroups[GroupIndex].Name);
+}
+
+bool SAdvanceDeletionTab::IsGroupLeader(FSuperManagerAssetRowId Row) const
+{
+	const int32 GroupIndex = GetRowGroup(Row);
+	if (GroupIndex == INDEX_NONE || RowGroups[GroupIndex].NumRows < 2) return false;
+
+	const int32 DisplayedIndex = GetDisplayedIndex(Row);
+	if (DisplayedIndex == INDEX_NONE) return false;
+
+	return DisplayedIndex == 0 || GetRowGroup(DisplayedRows[DisplayedIndex - 1]) != GroupIndex;
+}
+
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructGroupToggle(FSuperManagerAssetRowId RowToDisplay)
+{
+	// Bound, the same widget leads its group or not as rows are collapsed, searched or removed
+	return SNew(SButton)
+		.ButtonStyle(FAppStyle::Get(), "NoBorder")
+		.ContentPadding(0.f)
+		.Visibility(this, &SAdvanceDeletionTab::GetGroupToggleVisibility, RowToDisplay)
+		.OnClicked(this, &SAdvanceDeletionTab::OnGroupToggleClicked, RowToDisplay)
+		[
+			SNew(SImage)
+			.Image(this, &SAdvanceDeletionTab::GetGroupToggleBrush, RowToDisplay)
+		];
+}
+
+EVisibility SAdvanceDeletionTab::GetGroupToggleVisibility(FSuperManagerAssetRowId Row) const
+{
+	// Hidden rather than collapsed inside groups, so the names of a group line up
+	if (!IsGroupingRows()) return EVisibility::Collapsed;
+
+	return IsGroupLeader(Row) ? EVisibility::Visible : EVisibility::Hidden;
+}
+
+const FSlateBrush* SAdvanceDeletionTab::GetGroupToggleBrush(FSuperManagerAssetRowId Row) const
+{
+	const int32 GroupIndex = GetRowGroup(Row);
+	const bool bCollapsed = GroupIndex != INDEX_NONE && IsGroupCollapsed(GroupIndex);
+
+	return FAppStyle::Get().GetBrush(bCollapsed ? "TreeArrow_Collapsed" : "TreeArrow_Expanded");
+}
+
+FText SAdvanceDeletionTab::GetGroupSizeText(FSuperManagerAssetRowId Row) const
+{
+	if (!IsGroupLeader(Row)) return FText::GetEmpty();
+
+	const int32 GroupIndex = GetRowGroup(Row);
+
+	// Copies also show what each of them takes
+	if (GroupContentHashes.IsValidIndex(GroupIndex))
+	{
+		return FText::FromString(FString::Printf(TEXT("(%d x %s)"), RowGroups[GroupIndex].NumRows,
+			*FText::AsMemory(GroupContentHashes[GroupIndex].PayloadBytes).ToString()));
+	}
+
+	return FText::FromString(FString::Printf(TEXT("(%d)"), RowGroups[GroupIndex].NumRows));
+}
+
+FReply SAdvanceDeletionTab::OnGroupToggleClicked(FSuperManagerAssetRowId Row)
+{
+	const int32 GroupIndex = GetRowGroup(Row);
+	if (GroupIndex == INDEX_NONE) return FReply::Handled();
+
+	if (GroupContentHashes.IsValidIndex(GroupIndex))
+	{
+		const uint64 GroupHash = GroupContentHashes[GroupIndex].Hash;
+
+		if (CollapsedContentHashes.Remove(GroupHash) == 0)
+		{
+			CollapsedContentHashes.Add(GroupHash);
+		}
+	}
+	else
+	{
+		const FName GroupName = RowGroups[GroupIndex].Name;
+
+		if (CollapsedGroupNames.Remove(GroupName) == 0)
+		{
+			CollapsedGroupNames.Add(GroupName);
+		}
+	}
+
+	// Only the displayed rows change, the grouping and the order stay
+	RedisplayListedRows();
+
+	return FReply::Handled();
+}
+
+#pragma endregion
+
+#pragma region SortableColumns
+
+TSharedRef<SHeaderRow> SAdvanceDeletionTab::ConstructHeaderRow()
+{
+	TSharedRef<SHeaderRow> ConstructedHeaderRow = SNew(SHeaderRow);
+
+	ConstructedHeaderRow->AddColumn(SHeaderRow::Column(AdvanceDeletionColumns::CheckBox)
+		.DefaultLabel(FText::GetEmpty())
+		.FixedWidth(30.f));
+
+	struct FSortableColumn
+	{
+		FName ColumnId;
+		const TCHAR* Label;
+		float FillWidth;
+	};
+
+	const FSortableColumn SortableColumns[] =
+	{
+		{ AdvanceDeletionColumns::Name,			TEXT("Name"),			0.25f },
+		{ AdvanceDeletionColumns::Class,		TEXT("Class"),			0.15f },
+		{ AdvanceDeletionColumns::Path,			TEXT("Path"),			0.25f },
+		{ AdvanceDeletionColumns::Size,			TEXT("Disk Size"),		0.15f },
+		{ AdvanceDeletionColumns::Referencers,	TEXT("Referencers"),	0.08f },
+		{ AdvanceDeletionColumns::Modified,		TEXT("Last Modified"),	0.12f },
+	};
+
+	for (const FSortableColumn& SortableColumn : SortableColumns)
+	{
+		ConstructedHeaderRow->AddColumn(SHeaderRow::Column(SortableColumn.ColumnId)
+			.DefaultLabel(FText::FromString(SortableColumn.Label))
+			.FillWidth(SortableColumn.FillWidth)
+			.SortMode(this, &SAdvanceDeletionTab::GetColumnSortMode, SortableColumn.ColumnId)
+			.SortPriority(this, &SAdvanceDeletionTab::GetColumnSortPriority, SortableColumn.ColumnId)
+			.OnSort(this, &SAdvanceDeletionTab::OnColumnSortModeChanged));
+	}
+
+	ConstructedHeaderRow->AddColumn(SHeaderRow::Column(AdvanceDeletionColumns::Delete)
+		.DefaultLabel(FText::GetEmpty())
+		.FixedWidth(80.f));
+
+	return ConstructedHeaderRow;
+}
+
+EColumnSortMode::Type SAdvanceDeletionTab::GetColumnSortMode(FName ColumnId) const
+{
+	if (ColumnId == PrimarySortColumn) return PrimarySortMode;
+	if (ColumnId == SecondarySortColumn) return SecondarySortMode;
+
+	return EColumnSortMode::None;
+}
+
+EColumnSortPriority::Type SAdvanceDeletionTab::GetColumnSortPriority(FName ColumnId) const
+{
+	return ColumnId == SecondarySortColumn ? EColumnSortPriority::Secondary : EColumnSortPriority::Primary;
+}
+
+void SAdvanceDeletionTab::OnColumnSortModeChanged(
+	EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	// Shift click on a header sets the secondary column
+	if (SortPriority == EColumnSortPriority::Secondary && ColumnId != PrimarySortColumn)
+	{
+		SecondarySortColumn = ColumnId;
+		SecondarySortMode = NewSortMode;
+	}
+	else
+	{
+		PrimarySortColumn = ColumnId;
+		PrimarySortMode = NewSortMode;
+
+		if (SecondarySortColumn == ColumnId)
+		{
+			SecondarySortColumn = NAME_None;
+			SecondarySortMode = EColumnSortMode::None;
+		}
+	}
+
+	// Rows listed without a scan (all assets, same name) have no size yet
+	if (ColumnId == AdvanceDeletionColumns::Size)
+	{
+		SuperManagerPackageSizes::GatherPackageSizes(*AssetTable, ListedRows, SuperManagerParallel::GetNumWorkers());
+		RefreshFolderSizes();
+	}
+
+	ResortListedRows();
+}
+
+int64 SAdvanceDeletionTab::GetSortKey(const FName& ColumnId, FSuperManagerAssetRowId Row) const
+{
+	if (ColumnId == AdvanceDeletionColumns::Name) return AssetTable->GetNameSortKey(Row);
+	if (ColumnId == AdvanceDeletionColumns::Class) return AssetTable->GetClassSortKey(Row);
+	if (ColumnId == AdvanceDeletionColumns::Path) return AssetTable->GetPathSortKey(Row);
+	if (ColumnId == AdvanceDeletionColumns::Size) return AssetTable->HasSize(Row) ? AssetTable->GetSize(Row).DiskBytes : -1;
+	if (ColumnId == AdvanceDeletionColumns::Referencers) return AssetTable->GetReferencerCount(Row);
+	if (ColumnId == AdvanceDeletionColumns::Modified) return AssetTable->GetModifiedTicks(Row);
+
+	return 0;
+}
+
+void SAdvanceDeletionTab::SortListedRows()
+{
+	if (PrimarySortMode == EColumnSortMode::None) return;
+
+	if (!AssetTable->HasSortKeys())
+	{
+		AssetTable->BuildSortKeys();
+	}
+
+	// Keys are read once per row, the sort itself only compares integers
+	struct FSortEntry
+	{
+		int64 GroupKey;
+		int32 GroupIndex;
+		int64 PrimaryKey;
+		int64 SecondaryKey;
+		FSuperManagerAssetRowId Row;
+	};
+
+	const int64 PrimarySign = PrimarySortMode == EColumnSortMode::Descending ? -1 : 1;
+	const int64 SecondarySign = SecondarySortMode == EColumnSortMode::Descending ? -1 : 1;
+	const bool bHasSecondary = SecondarySortMode != EColumnSortMode::None;
+
+	TArray<FSortEntry> SortEntries;
+	SortEntries.SetNumUninitialized(ListedRows.Num());
+
+	for (int32 ListedIndex = 0; ListedIndex < ListedRows.Num(); ++ListedIndex)
+	{
+		const FSuperManagerAssetRowId Row = ListedRows[ListedIndex];
+
+		SortEntries[ListedIndex].PrimaryKey = PrimarySign * GetSortKey(PrimarySortColumn, Row);
+		SortEntries[ListedIndex].SecondaryKey = bHasSecondary ? SecondarySign * GetSortKey(SecondarySortColumn, Row) : 0;
+		SortEntries[ListedIndex].GroupIndex = GetRowGroup(Row);
+		SortEntries[ListedIndex].Row = Row;
+	}
+
+	// Groups stay together, ordered by their best row, then sorted inside
+	TArray<int64> GroupKeys;
+	GroupKeys.Init(TNumericLimits<int64>::Max(), RowGroups.Num());
+
+	for (const FSortEntry& SortEntry : SortEntries)
+	{
+		if (SortEntry.GroupIndex != INDEX_NONE)
+		{
+			GroupKeys[SortEntry.GroupIndex] = FMath::Min(GroupKeys[SortEntry.GroupIndex], SortEntry.PrimaryKey);
+		}
+	}
+
+	for (FSortEntry& SortEntry : SortEntries)
+	{
+		SortEntry.GroupKey = SortEntry.GroupIndex != INDEX_NONE ? GroupKeys[SortEntry.GroupIndex] : 0;
+	}
+
+	SuperManagerParallel::ParallelStableSort(SortEntries, SuperManagerParallel::GetNumWorkers(),
+		[](const FSortEntry& A, const FSortEntry& B)
+		{
+			if (A.GroupKey != B.GroupKey) return A.GroupKey < B.GroupKey;
+			if (A.GroupIndex != B.GroupIndex) return A.GroupIndex < B.GroupIndex;
+
+			return A.PrimaryKey != B.PrimaryKey ? A.PrimaryKey < B.PrimaryKey : A.SecondaryKey < B.SecondaryKey;
+		});
+
+	for (int32 ListedIndex = 0; ListedIndex < ListedRows.Num(); ++ListedIndex)
+	{
+		ListedRows[ListedIndex] = SortEntries[ListedIndex].Row;
+	}
+}
+
+void SAdvanceDeletionTab::ResortListedRows()
+{
+	BuildRowGroups();
+	SortListedRows();
+	RedisplayListedRows();
+}
+
+void SAdvanceDeletionTab::RedisplayListedRows()
+{
+	TArray<FSuperManagerAssetRowId> CheckedRowIds;
+
+	for (TConstSetBitIterator<> CheckedRow(CheckedRows); CheckedRow; ++CheckedRow)
+	{
+		CheckedRowIds.Add(DisplayedRows[CheckedRow.GetIndex()]);
+	}
+
+	ApplySearchFilter();
+	ResetRowState();
+
+	for (const FSuperManagerAssetRowId& CheckedRowId : CheckedRowIds)
+	{
+		const int32 DisplayedIndex = GetDisplayedIndex(CheckedRowId);
+
+		if (DisplayedIndex != INDEX_NONE)
+		{
+			CheckedRows[DisplayedIndex] = true;
+		}
+	}
+
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->RequestListRefresh();
+	}
+}
+
+#pragma endregion
+
+#pragma region CheckState
+
+void SAdvanceDeletionTab::ResetRowState()
+{
+	CheckedRows.Init(false, DisplayedRows.Num());
+	RowToDisplayedIndex.Init(INDEX_NONE, AssetTable->Num());
+	LastToggledRow = INDEX_NONE;
+
+	AppendRowState(0);
+}
+
+void SAdvanceDeletionTab::AppendRowState(int32 FirstNewRow)
+{
+	CheckedRows.Add(false, DisplayedRows.Num() - CheckedRows.Num());
+
+	// Live updates append rows to the table after the tab was built
+	for (int32 RowIndex = RowToDisplayedIndex.Num(); RowIndex < AssetTable->Num(); ++RowIndex)
+	{
+		RowToDisplayedIndex.Add(INDEX_NONE);
+	}
+
+	for (int32 RowIndex = FirstNewRow; RowIndex < DisplayedRows.Num(); ++RowIndex)
+	{
+		RowToDisplayedIndex[DisplayedRows[RowIndex].Index] = RowIndex;
+	}
+}
+
+int32 SAdvanceDeletionTab::GetDisplayedIndex(FSuperManagerAssetRowId Row) const
+{
+	return RowToDisplayedIndex.IsValidIndex(Row.Index) ? RowToDisplayedIndex[Row.Index] : INDEX_NONE;
+}
+
+ECheckBoxState SAdvanceDeletionTab::GetCheckBoxState(FSuperManagerAssetRowId Row) const
+{
+	const int32 RowIndex = GetDisplayedIndex(Row);
+
+	return RowIndex != INDEX_NONE && CheckedRows[RowIndex] ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+#pragma endregion
+
+#pragma region RowRemoval
+
+int32 SAdvanceDeletionTab::MarkDeletedRows(const TArray<FSuperManagerAssetRowId>& Rows)
+{
+	int32 NumDeleted = 0;
+
+	// Gone from the registry means deleted, rows kept by a cancelled dialog or a failed delete stay listed
+	for (const FSuperManagerAssetRowId& Row : Rows)
+	{
+		if (!AssetTable->FindAssetData(Row).IsValid())
+		{
+			AssetTable->SetFlags(Row, ESuperManagerAssetRowFlags::Deleted);
+			++NumDeleted;
+		}
+	}
+
+	return NumDeleted;
+}
+
+void SAdvanceDeletionTab::CompactDeletedRows()
+{
+	auto IsDeleted = [this](const FSuperManagerAssetRowId& Row)
+	{
+		return AssetTable->HasFlags(Row, ESuperManagerAssetRowFlags::Deleted);
+	};
+
+	TSet<int32> DeletedRows;
+
+	for (const FSuperManagerAssetRowId& Row : StoreRows)
+	{
+		if (IsDeleted(Row))
+		{
+			DeletedRows.Add(Row.Index);
+		}
+	}
+
+	StoreRows.RemoveAll(IsDeleted);
+	SourceRows.RemoveAll(IsDeleted);
+	ListedRows.RemoveAll(IsDeleted);
+	SearchMatches.RemoveAll(IsDeleted);
+
+	RemoveDisplayedRows(IsDeleted);
+	FilterPipeline.MarkTableChanged();
+
+	// Groups lost rows, a group down to one row drops its toggle.
+	// Removing one of two same name assets, or of two copies, also unlists the other one
+	if (IsGroupingRows())
+	{
+		ReevaluateRows(DeletedRows);
+		ResortListedRows();
+	}
+
+	RefreshFolderSizes();
+}
+
+void SAdvanceDeletionTab::RemoveDisplayedRows(TFunctionRef<bool(FSuperManagerAssetRowId)> ShouldRemove)
+{
+	// Displayed rows move down together with their check bits
+	TBitArray<> CompactedCheckedRows;
+	int32 NumKept = 0;
+
+	for (int32 DisplayedIndex = 0; DisplayedIndex < DisplayedRows.Num(); ++DisplayedIndex)
+	{
+		const FSuperManagerAssetRowId Row = DisplayedRows[DisplayedIndex];
+
+		if (ShouldRemove(Row))
+		{
+			RowToDisplayedIndex[Row.Index] = INDEX_NONE;
+			continue;
+		}
+
+		RowToDisplayedIndex[Row.Index] = NumKept;
+		CompactedCheckedRows.Add(CheckedRows[DisplayedIndex]);
+		DisplayedRows[NumKept++] = Row;
+	}
+
+	if (NumKept == DisplayedRows.Num()) return;
+
+	DisplayedRows.SetNum(NumKept, false);
+	CheckedRows = MoveTemp(CompactedCheckedRows);
+	LastToggledRow = INDEX_NONE;
+
+	// Order is unchanged, only the widgets of removed rows go away
+	if (ConstructedAssetListView.IsValid())
+	{
+		ConstructedAssetListView->RequestListRefresh();
+	}
+}
+
+#pragma endregion
+
+#pragma region LiveUpdate
+
+void SAdvanceDeletionTab::RegisterLiveUpdates()
+{
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddSP(this, &SAdvanceDeletionTab::OnRegistryAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddSP(this, &SAdvanceDeletionTab::OnRegistryAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddSP(this, &SAdvanceDeletionTab::OnRegistryAssetRenamed);
+
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	ReferencersChangedHandle = SuperManagerModule.GetReferenceIndex().OnReferencersChanged()
+		.AddSP(this, &SAdvanceDeletionTab::OnReferencersChanged);
+}
+
+void SAdvanceDeletionTab::UnregisterLiveUpdates()
+{
+	// The tab can outlive either module on editor shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	if (FSuperManagerModule* SuperManagerModule = FModuleManager::GetModulePtr<FSuperManagerModule>(TEXT("SuperManager")))
+	{
+		SuperManagerModule->GetReferenceIndex().OnReferencersChanged().Remove(ReferencersChangedHandle);
+	}
+}
+
+void SAdvanceDeletionTab::OnRegistryAssetAdded(const FAssetData& AssetData)
+{
+	if (!IsUnderSelectedFolders(AssetData.PackagePath)) return;
+
+	PendingAddedAssets.Add(AssetData.GetSoftObjectPath());
+	RequestLiveUpdate();
+}
+
+void SAdvanceDeletionTab::OnRegistryAssetRemoved(const FAssetData& AssetData)
+{
+	if (!IsUnderSelectedFolders(AssetData.PackagePath)) return;
+
+	PendingRemovedAssets.Add(AssetData.GetSoftObjectPath());
+	RequestLiveUpdate();
+}
+
+void SAdvanceDeletionTab::OnRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	// A rename is a remove of the old row and an add of the new one, either side can be outside the folder
+	const FSoftObjectPath OldPath(OldObjectPath);
+
+	if (IsUnderSelectedFolders(FName(*FPackageName::GetLongPackagePath(OldPath.GetLongPackageName()))))
+	{
+		PendingRemovedAssets.Add(OldPath);
+		RequestLiveUpdate();
+	}
+
+	OnRegistryAssetAdded(AssetData);
+}
+
+void SAdvanceDeletionTab::OnReferencersChanged(const TArray<FName>& ChangedPackages)
+{
+	PendingReferencerChanges.Append(ChangedPackages);
+	RequestLiveUpdate();
+}
+
+void SAdvanceDeletionTab::RequestLiveUpdate()
+{
+	if (LiveUpdateTimerHandle.IsValid()) return;
+
+	LiveUpdateTimerHandle = RegisterActiveTimer(0.f,
+		FWidgetActiveTimerDelegate::CreateSP(this, &SAdvanceDeletionTab::ApplyLiveUpdates));
+}
+
+EActiveTimerReturnType SAdvanceDeletionTab::ApplyLiveUpdates(double InCurrentTime, float InDeltaTime)
+{
+	// The scan worker reads the table columns, wait until it is done
+	if (ActiveScan.IsValid()) return EActiveTimerReturnType::Continue;
+
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	// Relinks the packages behind the queued events, which may queue more referencer changes
+	const FSuperManagerReferenceIndex& Index = SuperManagerModule.GetReferenceIndex();
+	const FSuperManagerPathExclusion& Exclusion = SuperManagerModule.GetPathExclusion();
+
+	TSet<int32> AffectedRows;
+
+	// Removals first, so an asset removed and added again in the same frame ends up with a fresh row
+	TArray<FSuperManagerAssetRowId> RemovedRows;
+
+	for (const FSoftObjectPath& ObjectPath : PendingRemovedAssets)
+	{
+		const FSuperManagerAssetRowId Row = AssetTable->FindRow(ObjectPath);
+		if (!Row.IsValid()) continue;
+
+		AssetTable->SetFlags(Row, ESuperManagerAssetRowFlags::Deleted);
+		RemovedRows.Add(Row);
+	}
+
+	if (RemovedRows.Num() > 0)
+	{
+		CompactDeletedRows();
+	}
+
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TArray<FSuperManagerAssetRowId> AddedRows;
+
+	for (const FSoftObjectPath& ObjectPath : PendingAddedAssets)
+	{
+		// Gone again before this frame, or already in the table
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(ObjectPath);
+		if (!AssetData.IsValid() || AssetTable->FindRow(ObjectPath).IsValid()) continue;
+		if (Exclusion.IsPackagePathExcluded(AssetData.PackagePath)) continue;
+
+		const FSuperManagerAssetRowId Row = AssetTable->AddAsset(AssetData);
+		AssetTable->SetReferencerCount(Row, Index.GetReferencerCount(AssetData.PackageName));
+		AssetTable->SetModifiedTicks(Row, Index.GetPackageTimeStamp(AssetData.PackageName));
+		NameSearch.AddRow(*AssetTable, Row);
+
+		StoreRows.Add(Row);
+		AddedRows.Add(Row);
+		AffectedRows.Add(Row.Index);
+
+		if (!SearchText.IsEmpty())
+		{
+			SearchMatchedRows.Add(false, AssetTable->Num() - SearchMatchedRows.Num());
+
+			if (NameSearch.Matches(Row, SearchText))
+			{
+				SearchMatchedRows[Row.Index] = true;
+				SearchMatches.Add(Row);
+			}
+		}
+	}
+
+	if (AddedRows.Num() > 0)
+	{
+		FilterPipeline.MarkTableChanged();
+
+		if (FilterPipeline.IsStageEnabled(ESuperManagerFilterStage::Size))
+		{
+			GatherMissingSizes(AddedRows);
+		}
+	}
+
+	TArray<FSuperManagerAssetRowId> ChangedRows;
+
+	for (const FName& PackageName : PendingReferencerChanges)
+	{
+		ChangedRows.Reset();
+		AssetTable->FindRows(PackageName, ChangedRows);
+
+		for (const FSuperManagerAssetRowId& Row : ChangedRows)
+		{
+			AssetTable->SetReferencerCount(Row, Index.GetReferencerCount(PackageName));
+			AffectedRows.Add(Row.Index);
+		}
+	}
+
+	PendingAddedAssets.Reset();
+	PendingRemovedAssets.Reset();
+	PendingReferencerChanges.Reset();
+
+	ReevaluateRows(AffectedRows);
+
+	LiveUpdateTimerHandle.Reset();
+	return EActiveTimerReturnType::Stop;
+}
+
+bool SAdvanceDeletionTab::IsUnderSelectedFolders(FName PackagePath) const
+{
+	const FString Path = PackagePath.ToString();
+
+	return FolderPaths.ContainsByPredicate([&Path](const FString& FolderPath)
+	{
+		return Path == FolderPath || (Path.StartsWith(FolderPath) && Path[FolderPath.Len()] == TEXT('/'));
+	});
+}
+
+bool SAdvanceDeletionTab::PassesListingCondition(FSuperManagerAssetRowId Row) const
+{
+	switch (ListingCondition)
+	{
+	case EAdvanceDeletionListing::All:
+		return true;
+
+	// Kept up to date from the reference index, same answer as IsPackageUnused
+	case EAdvanceDeletionListing::Unused:
+		return AssetTable->GetReferencerCount(Row) == 0;
+
+	// Bits marked by the last unreachable scan, rows are only reevaluated once it is complete
+	case EAdvanceDeletionListing::Unreachable:
+		return ReachableNodes.IsValid() && !FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"))
+			.GetReferenceIndex().IsPackageReachable(AssetTable->GetPackageName(Row), *ReachableNodes);
+
+	default:
+		return false;
+	}
+}
+
+void SAdvanceDeletionTab::ReevaluateRows(const TSet<int32>& AffectedRows)
+{
+	if (AffectedRows.Num() == 0) return;
+
+	// Row index -> whether the listing condition keeps it
+	TMap<int32, bool> InSource;
+
+	const bool bSameNameListing = ListingCondition == EAdvanceDeletionListing::SameName;
+
+	if (ListingCondition == EAdvanceDeletionListing::ContentDuplicates)
+	{
+		// A copy leaves the list with the last copy in another package. New rows wait for the next scan
+		const FSuperManagerContentHashCache& ContentHashCache =
+			FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager")).GetContentHashCache();
+
+		TMap<FSuperManagerContentHash, TSet<FName>> PackagesByHash;
+
+		for (const int32 RowIndex : AffectedRows)
+		{
+			const FSuperManagerContentHash ContentHash =
+				ContentHashCache.FindContentHash(AssetTable->GetPackageName(FSuperManagerAssetRowId(RowIndex)));
+
+			if (ContentHash.IsValid())
+			{
+				PackagesByHash.Add(ContentHash);
+			}
+		}
+
+		for (const FSuperManagerAssetRowId& Row : SourceRows)
+		{
+			const FName PackageName = AssetTable->GetPackageName(Row);
+
+			if (TSet<FName>* Packages = PackagesByHash.Find(ContentHashCache.FindContentHash(PackageName)))
+			{
+				Packages->Add(PackageName);
+				InSource.Add(Row.Index, false);
+			}
+		}
+
+		for (TPair<int32, bool>& Entry : InSource)
+		{
+			const FName PackageName = AssetTable->GetPackageName(FSuperManagerAssetRowId(Entry.Key));
+
+			Entry.Value = PackagesByHash[ContentHashCache.FindContentHash(PackageName)].Num() > 1;
+		}
+	}
+	else if (bSameNameListing || FilterPipeline.IsStageEnabled(ESuperManagerFilterStage::SameName))
+	{
+		// A name joins or leaves the list with every row carrying it
+		TMap<FName, int32> NameCounts;
+
+		for (const int32 RowIndex : AffectedRows)
+		{
+			NameCounts.Add(AssetTable->GetAssetName(FSuperManagerAssetRowId(RowIndex)), 0);
+		}
+
+		for (const FSuperManagerAssetRowId& Row : StoreRows)
+		{
+			if (int32* NameCount = NameCounts.Find(AssetTable->GetAssetName(Row)))
+			{
+				++(*NameCount);
+				InSource.Add(Row.Index, false);
+			}
+		}
+
+		for (TPair<int32, bool>& Entry : InSource)
+		{
+			const FSuperManagerAssetRowId Row(Entry.Key);
+
+			Entry.Value = bSameNameListing
+				? NameCounts[AssetTable->GetAssetName(Row)] > 1
+				: PassesListingCondition(Row);
+		}
+	}
+	else
+	{
+		for (const int32 RowIndex : AffectedRows)
+		{
+			const FSuperManagerAssetRowId Row(RowIndex);
+			if (AssetTable->HasFlags(Row, ESuperManagerAssetRowFlags::Deleted)) continue;
+
+			InSource.Add(RowIndex, PassesListingCondition(Row));
+		}
+	}
+
+	TArray<FSuperManagerAssetRowId> RowsInSource;
+	TArray<FSuperManagerAssetRowId> RowsOutOfSource;
+
+	for (const TPair<int32, bool>& Entry : InSource)
+	{
+		(Entry.Value ? RowsInSource : RowsOutOfSource).Add(FSuperManagerAssetRowId(Entry.Key));
+	}
+
+	RowsInSource.Sort([](const FSuperManagerAssetRowId& A, const FSuperManagerAssetRowId& B)
+	{
+		return A.Index < B.Index;
+	});
+
+	FilterPipeline.UpdateRows(*AssetTable, RowsInSource, true);
+	FilterPipeline.UpdateRows(*AssetTable, RowsOutOfSource, false);
+
+	TSet<int32> AlreadyInSource;
+
+	SourceRows.RemoveAll([&InSource, &AlreadyInSource](const FSuperManagerAssetRowId& Row)
+	{
+		const bool* bInSource = InSource.Find(Row.Index);
+		if (!bInSource) return false;
+
+		AlreadyInSource.Add(Row.Index);
+		return !*bInSource;
+	});
+
+	for (const FSuperManagerAssetRowId& Row : RowsInSource)
+	{
+		if (!AlreadyInSource.Contains(Row.Index))
+		{
+			SourceRows.Add(Row);
+		}
+	}
+
+	// Listed only when the listing condition and every filter stage keep it
+	TMap<int32, bool> ShouldList;
+
+	for (const TPair<int32, bool>& Entry : InSource)
+	{
+		ShouldList.Add(Entry.Key, Entry.Value && FilterPipeline.Passes(FSuperManagerAssetRowId(Entry.Key)));
+	}
+
+	TSet<int32> RowsToUnlist;
+	TSet<int32> AlreadyListed;
+
+	for (const FSuperManagerAssetRowId& Row : ListedRows)
+	{
+		if (const bool* bShouldList = ShouldList.Find(Row.Index))
+		{
+			AlreadyListed.Add(Row.Index);
+
+			if (!*bShouldList)
+			{
+				RowsToUnlist.Add(Row.Index);
+			}
+		}
+	}
+
+	TArray<FSuperManagerAssetRowId> RowsToList;
+
+	for (const TPair<int32, bool>& Entry : ShouldList)
+	{
+		if (Entry.Value && !AlreadyListed.Contains(Entry.Key))
+		{
+			RowsToList.Add(FSuperManagerAssetRowId(Entry.Key));
+		}
+	}
+
+	if (RowsToUnlist.Num() > 0)
+	{
+		auto IsUnlisted = [&RowsToUnlist](const FSuperManagerAssetRowId& Row)
+		{
+			return RowsToUnlist.Contains(Row.Index);
+		};
+
+		ListedRows.RemoveAll(IsUnlisted);
+		RemoveDisplayedRows(IsUnlisted);
+	}
+
+	if (RowsToList.Num() > 0)
+	{
+		// New rows go to the end, the current sort order of the others is kept
+		RowsToList.Sort([](const FSuperManagerAssetRowId& A, const FSuperManagerAssetRowId& B)
+		{
+			return A.Index < B.Index;
+		});
+
+		const int32 FirstNewDisplayedRow = DisplayedRows.Num();
+
+		for (const FSuperManagerAssetRowId& Row : RowsToList)
+		{
+			ListedRows.Add(Row);
+
+			if (PassesSearch(Row))
+			{
+				DisplayedRows.Add(Row);
+			}
+		}
+
+		AppendRowState(FirstNewDisplayedRow);
+
+		if (ConstructedAssetListView.IsValid())
+		{
+			ConstructedAssetListView->RequestListRefresh();
+		}
+	}
+
+	if (RowsToUnlist.Num() > 0 || RowsToList.Num() > 0)
+	{
+		// New rows join their group instead of staying at the end
+		if (IsGroupingRows())
+		{
+			ResortListedRows();
+		}
+
+		RefreshFolderSizes();
+	}
+}
+#pragma endregion
+
+#pragma region RowWidgetForAssetListView
+
+TSharedRef<ITableRow> SAdvanceDeletionTab::OnGenerateRowForList(
+	FSuperManagerAssetRowId RowToDisplay, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	if (!RowToDisplay.IsValid()) 
+		return SNew(STableRow<FSuperManagerAssetRowId>, OwnerTable);
+
+	TSharedRef<SAdvanceDeletionAssetRow> ListViewRowWidget =
+		SNew(SAdvanceDeletionAssetRow, OwnerTable)
+		.OnGenerateCell(this, &SAdvanceDeletionTab::ConstructCellForColumn, RowToDisplay);
+
+	return ListViewRowWidget;
+}
+
+TSharedRef<SWidget> SAdvanceDeletionTab::ConstructCellForColumn(const FName& ColumnId, FSuperManagerAssetRowId RowToDisplay)
+{
+	FSlateFontInfo AssetClassNameFont = GetEmbossedTextFont();
+	AssetClassNameFont.Size = 10;
+
+	FSlateFontInfo AssetNameFont = GetEmbossedTextFont();
+	AssetNameFont.Size = 15;
+
+	// 1. 체크박스
+	if (ColumnId == AdvanceDeletionColumns::CheckBox)
+	{
+		return ConstructCheckBox(RowToDisplay);
+	}
+
+	// 2. 자산 클래스 이름. Names only, the class is not looked up and the asset is not loaded
+	if (ColumnId == AdvanceDeletionColumns::Class)
+	{
+		return ConstructTextForRowWidget(AssetTable->GetClassName(RowToDisplay).ToString(), AssetClassNameFont);
+	}
+
+	// 3. 실제 에셋 이름. The first row of a same name or copy group folds the group
+	if (ColumnId == AdvanceDeletionColumns::Name)
+	{
+		return SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				ConstructGroupToggle(RowToDisplay)
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				ConstructTextForRowWidget(AssetTable->GetAssetName(RowToDisplay).ToString(), AssetNameFont)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SAdvanceDeletionTab::GetGroupSizeText, RowToDisplay)
+				.Font(AssetClassNameFont)
+				.ColorAndOpacity(FColor::White)
+			];
+	}
+
+	if (ColumnId == AdvanceDeletionColumns::Path)
+	{
+		return ConstructTextForRowWidget(
+			FPackageName::GetLongPackagePath(AssetTable->GetPackageName(RowToDisplay).ToString()), AssetClassNameFont);
+	}
+
+	// Disk and estimated cooked size of the package
+	if (ColumnId == AdvanceDeletionColumns::Size)
+	{
+		return ConstructTextForRowWidget(GetPackageSizeText(RowToDisplay), AssetClassNameFont);
+	}
+
+	if (ColumnId == AdvanceDeletionColumns::Referencers)
+	{
+		return SNew(STextBlock)
+			.Text(this, &SAdvanceDeletionTab::GetReferencerCountText, RowToDisplay)
+			.Font(AssetClassNameFont)
+			.ColorAndOpacity(FColor::White);
+	}
+
+	if (ColumnId == AdvanceDeletionColumns::Modified)
+	{
+		const int64 ModifiedTicks = AssetTable->GetModifiedTicks(RowToDisplay);
+
+		return ConstructTextForRowWidget(
+			ModifiedTicks > 0 ? FText::AsDateTime(FDateTime(ModifiedTicks)).ToString() : FString(), AssetClassNameFont);
+	}
+
+	// 4. 삭제 버튼
+	if (ColumnId == AdvanceDeletionColumns::Delete)
+	{
+		return ConstructButtonForRowWidget(RowToDisplay);
+	}
+
+	return SNullWidget::NullWidget;
+}
+
+void SAdvanceDeletionTab::OnRowWidgetMouseButtonClicked(FSuperManagerAssetRowId ClickedRow)
+{
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+
+	SuperManagerModule.SyncCBToClickedAssetForAssetList(AssetTable->GetObjectPath(ClickedRow).ToString());
+}
+
+TSharedRef<SCheckBox> SAdvanceDeletionTab::ConstructCheckBox(FSuperManagerAssetRowId RowToDisplay)
+{
+	TSharedRef<SCheckBox> ConstructedCheckBox =
+		SNew(SCheckBox)
+		.Type(ESlateCheckBoxType::CheckBox)
+		.IsChecked(this, &SAdvanceDeletionTab::GetCheckBoxState, RowToDisplay)
+		.OnCheckStateChanged(this, &SAdvanceDeletionTab::OnCheckBoxStateChanged, RowToDisplay)
+		.Visibility(EVisibility::Visible);
+
+	return ConstructedCheckBox;
+}
+
+void SAdvanceDeletionTab::OnCheckBoxStateChanged(ECheckBoxState NewState, FSuperManagerAssetRowId Row)
+{
+	const int32 RowIndex = GetDisplayedIndex(Row);
+	if (RowIndex == INDEX_NONE || NewState == ECheckBoxState::Undetermined) return;
+
+	const bool bChecked = NewState == ECheckBoxState::Checked;
+
+	// Shift click sets every row between the last toggled one and this one
+	if (LastToggledRow != INDEX_NONE && FSlateApplication::Get().GetModifierKeys().IsShiftDown())
+	{
+		const int32 FirstRow = FMath::Min(LastToggledRow, RowIndex);
+		CheckedRows.SetRange(FirstRow, FMath::Max(LastToggledRow, RowIndex) - FirstRow + 1, bChecked);
+	}
+	else
+	{
+		CheckedRows[RowIndex] = bChecked;
+	}
+
+	LastToggledRow = RowIndex;
+}
+
+TSharedRef<STextBlock> SAdvanceDeletionTab::ConstructTextForRowWidget(const FString& TextContent, const FSlateFontInfo& FontToUse)
+{
+	TSharedRef<STextBlock> ContstructedTextBlock =
+		SNew(STextBlock)
+		.Text(FText::FromString(TextContent))
+		.Font(FontToUse)
+		.ColorAndOpacity(FColor::White);
+
+	return ContstructedTextBlock;
+}
+
+FText SAdvanceDeletionTab::GetReferencerCountText(FSuperManagerAssetRowId Row) const
+{
+	return FText::AsNumber(AssetTable->GetReferencerCount(Row));
+}
+
+TSharedRef<SButton> SAdvanceDeletionTab::ConstructButtonForRowWidget(FSuperManagerAssetRowId RowToDisplay)
+{
+	TSharedRef<SButton> ConstructButton =
+		SNew(SButton)
+		.Text(FText::FromString(TEXT("Delete")))
+		.OnClicked(this, &SAdvanceDeletionTab::OnDeleteButtonClicked, RowToDisplay);
+	
+	return ConstructButton;
+}
+
+FReply SAdvanceDeletionTab::OnDeleteButtonClicked(FSuperManagerAssetRowId ClickedRow)
+{
+	FSuperManagerModule& SuperManagerModule = 
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	// The full asset data is only looked up when it is needed
+	const FAssetData ClickedAssetData = AssetTable->FindAssetData(ClickedRow);
+
+	const bool bAssetDeleted = ClickedAssetData.IsValid() && SuperManagerModule.DeleteSingleAssetForAssetList(ClickedAssetData);
+
+	if (bAssetDeleted)
+	{
+		// Updating the list source items
+		TArray<FSuperManagerAssetRowId> DeletedRows;
+		DeletedRows.Add(ClickedRow);
+
+		MarkDeletedRows(DeletedRows);
+		CompactDeletedRows();
+	}
+
+	return FReply::Handled();
+}
+
+#pragma endregion
+
+
+#pragma region TabButtons
+
+TSharedRef<SButton> SAdvanceDeletionTab::ConstructDeleteAllButton()
+{
+	TSharedRef<SButton> DeleteAllButton =
+		SNew(SButton)
+		.ContentPadding(FMargin(5.f))
+		.OnClicked(this, &SAdvanceDeletionTab::OnDeleteAllButtonClicked);
+
+	DeleteAllButton->SetContent(ConstructTextForTabButtons(TEXT("Delete All")));
+
+	return DeleteAllButton;
+}
+
+FReply SAdvanceDeletionTab::OnDeleteAllButtonClicked()
+{
+	// Checked rows, generated or not
+	TArray<FSuperManagerAssetRowId> RowsToDelete;
+
+	for (TConstSetBitIterator<> CheckedRow(CheckedRows); CheckedRow; ++CheckedRow)
+	{
+		RowsToDelete.Add(DisplayedRows[CheckedRow.GetIndex()]);
+	}
+
+	if (RowsToDelete.Num() == 0)
+	{
+		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, TEXT("No Asset currently selected."));
+		return FReply::Handled();
+	}
+
+	// sharedptr을 자산데이터로 변환한 뒤, 모듈 내부에 있는 DeleteMutipleAssetsForAssetList() 함수 호출.
+
+	TArray<FAssetData> AssetDataToDelete;
+	AssetDataToDelete.Reserve(RowsToDelete.Num());
+
+	for (const FSuperManagerAssetRowId& Row : RowsToDelete)
+	{
+		const FAssetData Data = AssetTable->FindAssetData(Row);
+
+		if (Data.IsValid())
+		{
+			AssetDataToDelete.Add(Data);
+		}
+	}
+
+	FSuperManagerModule& SuperManagerModule =
+		FModuleManager::LoadModuleChecked<FSuperManagerModule>(TEXT("SuperManager"));
+
+	const bool bAssetsDeleted = SuperManagerModule.DeleteMutipleAssetsForAssetList(AssetDataToDelete);
+	if (bAssetsDeleted)
+	{
+		// 저장 데이터 업데이트
+		MarkDeletedRows(RowsToDelete);
+		CompactDeletedRows();
 	}
 
 	return FReply::Handled();
 }
 
+TSharedRef<SButton> SAdvanceDeletionTab::ConstructSelectAllButton()
+{
+	TSharedRef<SButton> SelectAllButton =
+		SNew(SButton)
+		.ContentPadding(FMargin(5.f))
+		.OnClicked(this, &SAdvanceDeletionTab::OnSelectedAllButtonClicked);
+
+	SelectAllButton->SetContent(ConstructTextForTabButtons(TEXT("Select All")));
+
+	return SelectAllButton;
+}
+
+FReply SAdvanceDeletionTab::OnSelectedAllButtonClicked()
+{
+	// Row widgets read their state from the bits, nothing else to update
+	CheckedRows.SetRange(0, CheckedRows.Num(), true);
+
+	return FReply::Handled();
+}
+
+TSharedRef<SButton> SAdvanceDeletionTab::ConstructDeselectAllButton()
+{
+	TSharedRef<SButton> DeselectAllButton =
+		SNew(SButton)
+		.ContentPadding(FMargin(5.f))
+		.OnClicked(this, &SAdvanceDeletionTab::OnDeselectAllButtonClicked);
+
+	DeselectAllButton->SetContent(ConstructTextForTabButtons(TEXT("Deselect All")));
+
+	return DeselectAllButton;
+}
+
+FReply SAdvanceDeletionTab::OnDeselectAllButtonClicked()
+{
+	CheckedRows.SetRange(0, CheckedRows.Num(), false);
+
+	return FReply::Handled();
+}
+
 TSharedRef<STextBlock> SAdvanceDeletionTab::ConstructTextForTabButtons(const FString& TextContent)
 {
 	FSlateFontInfo ButtonTextFont = GetEmbossedTextFont();
@@ -10,14 +10,34 @@
 #include <Widgets/Docking/SDockTab.h>
 #include "SlateWidgets/AdvanceDeletionWidget.h"
 #include "CustomStyle/SuperManagerStyle.h"
+#include "AssetIndex/SuperManagerRootSet.h"
+#include "AssetIndex/SuperManagerAssetScan.h"
+#include "AssetIndex/SuperManagerParallel.h"
+#include "AssetIndex/SuperManagerPackageDeletion.h"
+#include "AssetIndex/SuperManagerPackageSizes.h"
+#include "AssetIndex/SuperManagerFolderTree.h"
+#include "AssetIndex/SuperManagerNameGroups.h"
+#include "AssetIndex/SuperManagerRedirectorFixup.h"
+#include "AssetIndex/SuperManagerRedirectorAudit.h"
+#include "Settings/SuperManagerSettings.h"
 
 #define LOCTEXT_NAMESPACE "FSuperManagerModule"
 
 void FSuperManagerModule::StartupModule()
 {
-	FSuperManagerStyle::InitializeIcons();
-	InitCBMenuExtention();
-	RegisterAdvancedDeletionTab();
+	// The SuperManagerAudit commandlet only needs the analysis side of the module
+	if (!IsRunningCommandlet())
+	{
+		FSuperManagerStyle::InitializeIcons();
+		InitCBMenuExtention();
+		RegisterAdvancedDeletionTab();
+	}
+
+	// Usable straight away from last session's graph, revalidated once the registry scan is done
+	ReferenceIndex.LoadFromCache(FSuperManagerReferenceIndex::GetDefaultCacheFilename());
+	RegisterReferenceIndexDelegates();
+
+	ContentHashCache.LoadFromCache(FSuperManagerContentHashCache::GetDefaultCacheFilename());
 }
 
 #pragma region	ContentBrowserMenuWxtention
@@ -87,19 +107,23 @@ void FSuperManagerModule::AddCBMenuEntry(FMenuBuilder& MenuBuilder)
 		// The actual funcion execute
 		FExecuteAction::CreateRaw(this, &FSuperManagerModule::OnAdvancedDeletionButtonClicked)
 	);
+
+	MenuBuilder.AddMenuEntry
+	(
+		FText::FromString(TEXT("Audit Redirectors")),						// Title text for menu entry
+		FText::FromString(TEXT("Collapse redirector chains under folder and fix up their referencers")),	// Tool tip text
+		FSlateIcon(FSuperManagerStyle::GetStyleSetName(), "ConteneBrowser.AdvancedDeletion"),	// Custom icon
+		// The actual funcion execute
+		FExecuteAction::CreateRaw(this, &FSuperManagerModule::OnAuditRedirectorsButtonClicked)
+	);
 }
 
 void FSuperManagerModule::OnDeleteUnusedAssetButtonClicked()
 {
-	if (FolderPathsSelected.Num() > 1)
-	{
-		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, TEXT("You can only do this to one folder!"));
-		return;
-	}
-
-	TArray<FString> AssetsPathNames = UEditorAssetLibrary::ListAssets(FolderPathsSelected[0]);
+	TArray<FAssetData> AssetsData;
+	GatherAssetsUnderFolders(FolderPathsSelected, AssetsData);
 
-	if (AssetsPathNames.Num() == 0)
+	if (AssetsData.Num() == 0)
 	{
 		// NO ASSETS!
 		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, TEXT("No Asset found under selected folder"));
@@ -108,43 +132,19 @@ void FSuperManagerModule::OnDeleteUnusedAssetButtonClicked()
 
 	EAppReturnType::Type ConfirmResult =
 		DebugHeader::ShowMsgDialog(	EAppMsgType::YesNo, TEXT("A Total of ")
-									+ FString::FromInt(AssetsPathNames.Num())
+									+ FString::FromInt(AssetsData.Num())
 									+ TEXT(" assets need to be checked. \n Would you like to proceed? "), false);
 
 	if (ConfirmResult == EAppReturnType::No) return;
 
-	FixUpRedirectors();
+	RedirectorFixup.FixUpRedirectors(FolderPathsSelected);
 
 	TArray<FAssetData> UnusedAssetsDataArray;
-	
-	for (const auto& AssetPathName : AssetsPathNames)
-	{
-		// Do not touch root Folder!
-		// __ExternalActors__  __ExternalObject__  UE5  ߰ .
-		// Developers, Collections   ǵ x
-		if (AssetPathName.Contains(TEXT("Developers")) ||
-			AssetPathName.Contains(TEXT("Collections")) ||
-			AssetPathName.Contains(TEXT("__ExternalActors__")) ||
-			AssetPathName.Contains(TEXT("__ExternalObject__")) )
-		{
-			continue;
-		}
-
-		if (!UEditorAssetLibrary::DoesAssetExist(AssetPathName)) continue;
-		
-		TArray<FString> AssetReferencers = 
-			UEditorAssetLibrary::FindPackageReferencersForAsset(AssetPathName);
-
-		if (AssetReferencers.Num() == 0)
-		{
-			const FAssetData UnusedAssetData = UEditorAssetLibrary::FindAssetData(AssetPathName);
-			UnusedAssetsDataArray.Add(UnusedAssetData);
-		}
-	}
+	FindUnusedAssets(AssetsData, UnusedAssetsDataArray);
 
 	if (UnusedAssetsDataArray.Num() > 0)
 	{
-		ObjectTools::DeleteAssets(UnusedAssetsDataArray);
+		DeleteAssetsWithoutLoading(UnusedAssetsDataArray);
 	}
 	else
 	{
@@ -162,34 +162,17 @@ void FSuperManagerModule::OnDeleteUnusedAssetButtonClicked()
 
 void FSuperManagerModule::OnDeleteEmptyFoldersButtonClicked()
 {
-	FixUpRedirectors();
+	RedirectorFixup.FixUpRedirectors(FolderPathsSelected);
 
-	TArray<FString> FolderPathsArray = UEditorAssetLibrary::ListAssets(FolderPathsSelected[0], true, true);
-	uint32 Counter = 0;
+	TArray<FString> EmptyFoldersPathsArray;
+	FindEmptyFolders(FolderPathsSelected, EmptyFoldersPathsArray);
 
 	FString EmptyFolderPathsNames;
-	TArray<FString> EmptyFoldersPathsArray;
 
-	for (const auto& FolderPath : FolderPathsArray)
+	for (const auto& EmptyFolderPath : EmptyFoldersPathsArray)
 	{
-		if (FolderPath.Contains(TEXT("Developers")) ||
-			FolderPath.Contains(TEXT("Collections")) ||
-			FolderPath.Contains(TEXT("__ExternalActors__")) ||
-			FolderPath.Contains(TEXT("__ExternalObject__")))
-		{
-			continue;
-		}
-
-		if (!UEditorAssetLibrary::DoesDirectoryExist(FolderPath)) continue;
-
-		if (!UEditorAssetLibrary::DoesDirectoryHaveAssets(FolderPath))
-		{
-			// for  ̹Ƿ  θ ֱ ؼ   Ѵ.
-			EmptyFolderPathsNames.Append(FolderPath);
-			EmptyFolderPathsNames.Append(TEXT("\n"));
-
-			EmptyFoldersPathsArray.Add(FolderPath);
-		}
+		EmptyFolderPathsNames.Append(EmptyFolderPath);
+		EmptyFolderPathsNames.Append(TEXT("\n"));
 	}
 
 	if (EmptyFoldersPathsArray.Num() == 0)
@@ -206,10 +189,14 @@ void FSuperManagerModule::OnDeleteEmptyFoldersButtonClicked()
 
 	if (ConfirmResult == EAppReturnType::Cancel) return;
 
-	for(const auto& EmptyFolderPath : EmptyFoldersPathsArray)
+	// One registry / content browser update for the whole batch
+	TArray<FString> FailedFolderPaths;
+	const int32 Counter = SuperManagerFolderTree::DeleteFolders(EmptyFoldersPathsArray, FailedFolderPaths);
+
+	if (FailedFolderPaths.Num() > 0)
 	{
-		UEditorAssetLibrary::DeleteDirectory(EmptyFolderPath) ?
-			++Counter : DebugHeader::Print(TEXT("Failed to delete : ") + EmptyFolderPath, FColor::Red);
+		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, FString::FromInt(FailedFolderPaths.Num())
+			+ TEXT(" folders could not be deleted : \n") + FString::Join(FailedFolderPaths, TEXT("\n")), false);
 	}
 
 	if (Counter > 0)
@@ -220,50 +207,31 @@ void FSuperManagerModule::OnDeleteEmptyFoldersButtonClicked()
 
 void FSuperManagerModule::OnAdvancedDeletionButtonClicked()
 {
-	FixUpRedirectors();
+	RedirectorFixup.FixUpRedirectors(FolderPathsSelected);
 
 	FGlobalTabmanager::Get()->TryInvokeTab(FName("AdvancedDeletion"));
 }
 
-void FSuperManagerModule::FixUpRedirectors()
+void FSuperManagerModule::OnAuditRedirectorsButtonClicked()
 {
-	TArray<UObjectRedirector*> RedirectorsToFixArray;
-
-	//    θ  FAssetRegistryModule  ؾ.
-	// 켱  ´.
-	FAssetRegistryModule& AssetRegistryModule =
-		FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-
-	// ϴ GetAssets  Ҷ ͸ Ѵ.
-	//  ֺ ͸ Ǵ    .
-	FARFilter Filter;
-	Filter.bRecursivePaths = true;
-	Filter.PackagePaths.Emplace("/Game");
-	Filter.ClassNames.Emplace("ObjectRedirector");
+	TArray<FSuperManagerRedirectorChain> RedirectorChains;
+	SuperManagerRedirectorAudit::BuildRedirectorChains(FolderPathsSelected, RedirectorChains);
 
-	// Ϳ شǴ  TArray · Ѵ.
-	TArray<FAssetData> OutRedirectors;
-	AssetRegistryModule.Get().GetAssets(Filter, OutRedirectors);
-
-
-	// UObjectRedirector  ü̸ ٸ Ű ׷ ٲ
-	// ش ü  ܺ  ã  .
-	// ü ٲ  ã RedirectorsToFixArray  ־.
-	for (const auto& RedirectorData : OutRedirectors)
+	if (RedirectorChains.Num() == 0)
 	{
-		if (UObjectRedirector* RedirectorToFix = Cast<UObjectRedirector>(RedirectorData.GetAsset()))
-		{
-			RedirectorsToFixArray.Add(RedirectorToFix);
-		}
+		DebugHeader::ShowMsgDialog(EAppMsgType::Ok, TEXT("No redirector found under selected folder"), false);
+		return;
 	}
 
-	// AssetTools  ȣ.
-	FAssetToolsModule& AssetToolsModule =
-		FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+	EAppReturnType::Type ConfirmResult =
+		DebugHeader::ShowMsgDialog(EAppMsgType::YesNo, SuperManagerRedirectorAudit::DescribeChains(RedirectorChains)
+			+ TEXT(". \n Would you like to fix all of them? "), false);
+
+	if (ConfirmResult == EAppReturnType::No) return;
 
+	const int32 NumFixed = SuperManagerRedirectorAudit::FixRedirectorChains(RedirectorChains, true);
 
-	// ȣ   θ ٲ.
-	AssetToolsModule.Get().FixupReferencers(RedirectorsToFixArray);
+	DebugHeader::ShowNotifyInfo(TEXT("Fixed up ") + FString::FromInt(NumFixed) + TEXT(" redirectors"));
 }
 
 #pragma endregion
@@ -284,39 +252,11 @@ TSharedRef<SDockTab> FSuperManagerModule::OnSpawnAdvanceDeletionTab(const FSpawn
 	SNew(SDockTab).TabRole(ETabRole::NomadTab)
 		[
 			SNew(SAdvanceDeletionTab)
-			.AssetsDataToStore(GetAllAssetDataUnderSelectedFolder())
-			.CurrentSelectedFolder(FolderPathsSelected[0])
+			.AssetTable(BuildAssetTableUnderFolders(FolderPathsSelected))
+			.SelectedFolders(FolderPathsSelected)
 		];
 }
 
-TArray<TSharedPtr<FAssetData>> FSuperManagerModule::GetAllAssetDataUnderSelectedFolder()
-{
-	TArray<TSharedPtr<FAssetData>> AvaliableAssetsData;
-
-	TArray<FString> AssetsPathNames = UEditorAssetLibrary::ListAssets(FolderPathsSelected[0]);
-
-	for (const auto& AssetPathName : AssetsPathNames)
-	{
-		// Do not touch root Folder!
-		// __ExternalActors__  __ExternalObject__  UE5  ߰ .
-		// Developers, Collections   ǵ x
-		if (AssetPathName.Contains(TEXT("Developers")) ||
-			AssetPathName.Contains(TEXT("Collections")) ||
-			AssetPathName.Contains(TEXT("__ExternalActors__")) ||
-			AssetPathName.Contains(TEXT("__ExternalObject__")))
-		{
-			continue;
-		}
-
-		if (!UEditorAssetLibrary::DoesAssetExist(AssetPathName)) continue;
-
-		const FAssetData Data =	UEditorAssetLibrary::FindAssetData(AssetPathName);
-		
-		AvaliableAssetsData.Add(MakeShared<FAssetData>(Data));
-	}
-	return AvaliableAssetsData;
-}
-
 #pragma endregion
 
 
@@ -327,7 +267,7 @@ bool FSuperManagerModule::DeleteSingleAssetForAssetList(const FAssetData& AssetD
 	TArray<FAssetData> AssetDataForDeletion;
 	AssetDataForDeletion.Add(AssetDataToDelete);
 
-	if (ObjectTools::DeleteAssets(AssetDataForDeletion) > 0)
+	if (DeleteAssetsWithoutLoading(AssetDataForDeletion) > 0)
 		return true;
 	
 	return false;
@@ -335,64 +275,403 @@ bool FSuperManagerModule::DeleteSingleAssetForAssetList(const FAssetData& AssetD
 
 bool FSuperManagerModule::DeleteMutipleAssetsForAssetList(const TArray<FAssetData>& AssetsToDelete)
 {
-	if (ObjectTools::DeleteAssets(AssetsToDelete) > 0)
+	if (DeleteAssetsWithoutLoading(AssetsToDelete) > 0)
 		return true;
 
 	return false;
 }
 
-void FSuperManagerModule::ListUnusedAssetsForAssetList(
-	const TArray<TSharedPtr<FAssetData>>& AssetsDataToFilter, TArray<TSharedPtr<FAssetData>>& OutUnusedAssetsData)
+void FSuperManagerModule::ListUnusedAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutUnusedRows)
+{
+	OutUnusedRows.Empty();
+
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	SuperManagerParallel::ParallelFilter(RowsToFilter, OutUnusedRows, SuperManagerParallel::GetNumWorkers(),
+		[&Index, &AssetTable](const FSuperManagerAssetRowId& Row)
+		{
+			return Index.IsPackageUnused(AssetTable.GetPackageName(Row));
+		});
+}
+
+void FSuperManagerModule::ListUnreachableAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutUnreachableRows)
+{
+	OutUnreachableRows.Empty();
+
+	// Unlike ListUnused this also catches clusters that only reference each other
+	TArray<FName> RootPackages;
+	SuperManagerRootSet::GatherRootPackages(RootPackages);
+
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	TBitArray<> ReachableNodes;
+	Index.MarkReachableFrom(RootPackages, ReachableNodes);
+
+	SuperManagerParallel::ParallelFilter(RowsToFilter, OutUnreachableRows, SuperManagerParallel::GetNumWorkers(),
+		[&Index, &AssetTable, &ReachableNodes](const FSuperManagerAssetRowId& Row)
+		{
+			return !Index.IsPackageReachable(AssetTable.GetPackageName(Row), ReachableNodes);
+		});
+}
+
+TSharedRef<FSuperManagerAssetScan> FSuperManagerModule::StartUnusedAssetsScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, bool bGatherPackageSizes)
+{
+	// Pending registry changes are applied here on the game thread, the worker only reads
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	TSharedRef<FSuperManagerAssetScan> Scan = MakeShared<FSuperManagerAssetScan>(AssetTable, RowsToFilter,
+		[&Index](FName PackageName)
+		{
+			return Index.IsPackageUnused(PackageName);
+		}, bGatherPackageSizes);
+
+	Scan->Start();
+	return Scan;
+}
+
+TSharedRef<FSuperManagerAssetScan> FSuperManagerModule::StartUnreachableAssetsScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, bool bGatherPackageSizes, TSharedPtr<const TBitArray<>>* OutReachableNodes)
 {
-	OutUnusedAssetsData.Empty();
+	// Roots come from settings objects and are gathered here, the walk over the graph runs on the worker
+	TArray<FName> RootPackages;
+	SuperManagerRootSet::GatherRootPackages(RootPackages);
+
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	// Marked by this scan alone, other scans and callers never see them change
+	TSharedRef<TBitArray<>> ReachableNodes = MakeShared<TBitArray<>>();
+
+	TSharedRef<FSuperManagerAssetScan> Scan = MakeShared<FSuperManagerAssetScan>(AssetTable, RowsToFilter,
+		[&Index, ReachableNodes](FName PackageName)
+		{
+			return !Index.IsPackageReachable(PackageName, *ReachableNodes);
+		}, bGatherPackageSizes);
+
+	Scan->SetPrepare([&Index, ReachableNodes, RootPackages = MoveTemp(RootPackages)]()
+	{
+		Index.MarkReachableFrom(RootPackages, *ReachableNodes);
+	});
 
-	for (const auto& DataSharedPtr : AssetsDataToFilter)
+	if (OutReachableNodes)
 	{
-		TArray<FString> AssetReferencers = 
-			UEditorAssetLibrary::FindPackageReferencersForAsset(DataSharedPtr->ObjectPath.ToString());
+		*OutReachableNodes = ReachableNodes;
+	}
+
+	Scan->Start();
+	return Scan;
+}
+
+void FSuperManagerModule::ListSameNameAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutSameNameRows)
+{
+	// Rows sharing a name are listed next to each other, groups in order of first appearance
+	TArray<FSuperManagerRowGroup> SameNameGroups;
+	SuperManagerNameGroups::GroupRowsByName(AssetTable, RowsToFilter, 2, OutSameNameRows, SameNameGroups);
+}
+
+TSharedRef<FSuperManagerAssetScan> FSuperManagerModule::StartContentHashScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToHash)
+{
+	FSuperManagerContentHashCache& Cache = GetContentHashCache();
 
-		if (AssetReferencers.Num() == 0)
+	TArray<FSuperManagerAssetRowId> PackageRows;
+	SuperManagerContentHashes::GatherUniquePackages(*AssetTable, RowsToHash, PackageRows);
+
+	// Packages unchanged since they were last hashed only cost a file stat
+	TSharedRef<FSuperManagerAssetScan> Scan = MakeShared<FSuperManagerAssetScan>(AssetTable, PackageRows,
+		[&Cache](FName PackageName)
 		{
-			OutUnusedAssetsData.Add(DataSharedPtr);
-		}
+			return Cache.GetContentHash(PackageName).IsValid();
+		});
+
+	Scan->Start();
+	return Scan;
+}
+
+void FSuperManagerModule::ListContentDuplicatesForAssetList(const FSuperManagerAssetTable& AssetTable,
+	const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutDuplicateRows)
+{
+	// Copies are listed next to each other, groups in order of first appearance
+	SuperManagerContentHashes::GroupDuplicateRows(GetContentHashCache(), AssetTable, RowsToFilter, OutDuplicateRows);
+}
+
+void FSuperManagerModule::SyncCBToClickedAssetForAssetList(const FString& AssetPathToSync)
+{
+	TArray<FString> AssetsPathToSync;
+	AssetsPathToSync.Add(AssetPathToSync);
+	UEditorAssetLibrary::SyncBrowserToObjects(AssetsPathToSync);
+}
+
+#pragma endregion
+
+#pragma region SharedAnalysis
+
+void FSuperManagerModule::FindUnusedAssets(const TArray<FAssetData>& AssetsData, TArray<FAssetData>& OutUnusedAssetsData)
+{
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	SuperManagerParallel::ParallelFilter(AssetsData, OutUnusedAssetsData, SuperManagerParallel::GetNumWorkers(),
+		[&Index](const FAssetData& AssetData)
+		{
+			return Index.IsPackageUnused(AssetData.PackageName);
+		});
+}
+
+void FSuperManagerModule::FindEmptyFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutEmptyFolderPaths)
+{
+	TArray<FString> RootPaths;
+	SuperManagerFolderTree::CollapseNestedFolders(FolderPaths, RootPaths);
+
+	// Topmost empty folders only, deleting one removes the empty folders under it
+	for (const FString& RootPath : RootPaths)
+	{
+		SuperManagerFolderTree::FindEmptyFolderRoots(RootPath, GetPathExclusion(), OutEmptyFolderPaths);
+	}
+}
+
+void FSuperManagerModule::GatherAssetsUnderFolders(const TArray<FString>& FolderPaths, TArray<FAssetData>& OutAssetsData)
+{
+	TArray<FString> RootPaths;
+	SuperManagerFolderTree::CollapseNestedFolders(FolderPaths, RootPaths);
+
+	// Compiled on the game thread here, workers only read it
+	const FSuperManagerPathExclusion& Exclusion = GetPathExclusion();
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	// The registry walks its own path tree and hands back its entries, no object path strings in between.
+	// On disk only queries do not touch UObjects and can run off the game thread
+	SuperManagerParallel::ParallelGather(RootPaths.Num(), FMath::Min(RootPaths.Num(), SuperManagerParallel::GetNumWorkers()), OutAssetsData,
+		[&](int32 RootIndex, TArray<FAssetData>& ChunkAssetsData)
+		{
+			FARFilter Filter;
+			Filter.PackagePaths.Emplace(*RootPaths[RootIndex]);
+			Filter.bRecursivePaths = true;
+			Filter.bIncludeOnlyOnDiskAssets = true;
+
+			TArray<FAssetData> RootAssetsData;
+			AssetRegistry.GetAssets(Filter, RootAssetsData);
+
+			ChunkAssetsData.Reserve(ChunkAssetsData.Num() + RootAssetsData.Num());
+
+			for (FAssetData& Data : RootAssetsData)
+			{
+				// Do not touch root Folder!
+				// __ExternalActors__ 와 __ExternalObject__ 는 UE5 부터 추가된 파일.
+				// Developers, Collections 와 마찬가지로 건들 x
+				if (Exclusion.IsPackagePathExcluded(Data.PackagePath)) continue;
+
+				ChunkAssetsData.Add(MoveTemp(Data));
+			}
+		});
+}
+
+TSharedRef<FSuperManagerAssetTable> FSuperManagerModule::BuildAssetTableUnderFolders(const TArray<FString>& FolderPaths)
+{
+	TArray<FAssetData> AvaliableAssetsData;
+	GatherAssetsUnderFolders(FolderPaths, AvaliableAssetsData);
+
+	// Only the fields the tab shows are kept, the FAssetData are dropped once the table is built
+	TSharedRef<FSuperManagerAssetTable> AssetTable = MakeShared<FSuperManagerAssetTable>();
+	AssetTable->Reserve(AvaliableAssetsData.Num());
+
+	const FSuperManagerReferenceIndex& Index = GetReferenceIndex();
+
+	for (const FAssetData& Data : AvaliableAssetsData)
+	{
+		const FSuperManagerAssetRowId Row = AssetTable->AddAsset(Data);
+		AssetTable->SetReferencerCount(Row, Index.GetReferencerCount(Data.PackageName));
+		AssetTable->SetModifiedTicks(Row, Index.GetPackageTimeStamp(Data.PackageName));
 	}
+
+	return AssetTable;
 }
 
-void FSuperManagerModule::ListSameNameAssetsForAssetList(
-	const TArray<TSharedPtr<FAssetData>>& AssetsDataToFilter, TArray<TSharedPtr<FAssetData>>& OutSameNameAssetsData)
+int32 FSuperManagerModule::DeleteAssetsWithoutLoading(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation)
 {
-	OutSameNameAssetsData.Empty();
+	TArray<FName> FastPathPackages;
+	TArray<FAssetData> FallbackAssets;
 
-	// Multimap for supportion finding assets with same name
-	TMultiMap<FString, TSharedPtr<FAssetData>> AssetsInfoMap;
+	// Every reference check runs here, before the only confirmation
+	SuperManagerPackageDeletion::PartitionAssets(AssetsToDelete, GetReferenceIndex(), FastPathPackages, FallbackAssets);
 
-	for (const auto& DataSharedPtr : AssetsDataToFilter)
+	if (bShowConfirmation)
 	{
-		AssetsInfoMap.Emplace(DataSharedPtr->AssetName.ToString(), DataSharedPtr);
+		FString Message = FString::FromInt(AssetsToDelete.Num()) + TEXT(" assets will be deleted.");
+
+		if (FallbackAssets.Num() > 0)
+		{
+			Message += TEXT(" \n ") + FString::FromInt(FallbackAssets.Num())
+				+ TEXT(" of them are loaded or referenced, those still referenced will be kept.");
+		}
+
+		EAppReturnType::Type ConfirmResult =
+			DebugHeader::ShowMsgDialog(EAppMsgType::YesNo, Message + TEXT(" \n Would you like to proceed? "), false);
+
+		if (ConfirmResult == EAppReturnType::No) return 0;
 	}
 
-	for (const auto& DataSharedPtr : AssetsDataToFilter)
+	// Counted in assets, like ObjectTools::DeleteAssets
+	int32 NumDeleted = 0;
+
+	if (FastPathPackages.Num() > 0)
 	{
-		TArray<TSharedPtr<FAssetData>> OutAssetsData;
-		AssetsInfoMap.MultiFind(DataSharedPtr->AssetName.ToString(), OutAssetsData);
+		TArray<FName> FailedPackages;
+		TArray<FName> PartlyDeletedPackages;
+		SuperManagerPackageDeletion::DeletePackageFiles(FastPathPackages, FailedPackages, PartlyDeletedPackages);
+
+		const TSet<FName> FastPathPackageSet(FastPathPackages);
+		const TSet<FName> FailedPackageSet(FailedPackages);
+		const TSet<FName> PartlyDeletedPackageSet(PartlyDeletedPackages);
+
+		for (const FAssetData& AssetData : AssetsToDelete)
+		{
+			if (!FastPathPackageSet.Contains(AssetData.PackageName) || PartlyDeletedPackageSet.Contains(AssetData.PackageName)) continue;
 
-		if (OutAssetsData.Num() <= 1) continue;
+			// Packages left untouched on disk (read only, locked...) get a second chance below
+			if (FailedPackageSet.Contains(AssetData.PackageName))
+			{
+				FallbackAssets.Add(AssetData);
+			}
+			else
+			{
+				++NumDeleted;
+			}
+		}
 
-		for (const auto& SameNameData : OutAssetsData)
+		// Never handed to ObjectTools, loading them would read a package without its split files
+		if (PartlyDeletedPackages.Num() > 0)
 		{
-			if (SameNameData.IsValid())
+			TArray<FString> PartlyDeletedPackagePaths;
+
+			for (const FName& PackageName : PartlyDeletedPackages)
+			{
+				PartlyDeletedPackagePaths.Add(PackageName.ToString());
+			}
+
+			const FString Message = FString::FromInt(PartlyDeletedPackages.Num())
+				+ TEXT(" packages were deleted but some of their .uexp / .ubulk / .uptnl files could not be removed : \n")
+				+ FString::Join(PartlyDeletedPackagePaths, TEXT("\n"));
+
+			if (bShowConfirmation)
 			{
-				OutSameNameAssetsData.AddUnique(SameNameData);
+				DebugHeader::ShowMsgDialog(EAppMsgType::Ok, Message, false);
+			}
+			else
+			{
+				DebugHeader::PrintLog(Message);
 			}
 		}
 	}
+
+	if (FallbackAssets.Num() > 0)
+	{
+		NumDeleted += ObjectTools::DeleteAssets(FallbackAssets, false);
+	}
+
+	return NumDeleted;
 }
 
-void FSuperManagerModule::SyncCBToClickedAssetForAssetList(const FString& AssetPathToSync)
+#pragma endregion
+
+#pragma region PathExclusion
+
+const FSuperManagerPathExclusion& FSuperManagerModule::GetPathExclusion()
 {
-	TArray<FString> AssetsPathToSync;
-	AssetsPathToSync.Add(AssetPathToSync);
-	UEditorAssetLibrary::SyncBrowserToObjects(AssetsPathToSync);
+	// Settings can be edited at any time, the trie is only rebuilt when the rules differ
+	const TArray<FString>& ExcludedPathRules = USuperManagerSettings::Get()->ExcludedPathRules;
+
+	if (!PathExclusion.IsCompiledFrom(ExcludedPathRules))
+	{
+		PathExclusion.Compile(ExcludedPathRules);
+	}
+
+	return PathExclusion;
+}
+
+#pragma endregion
+
+#pragma region ReferenceIndex
+
+FSuperManagerReferenceIndex& FSuperManagerModule::GetReferenceIndex()
+{
+	if (!ReferenceIndex.IsBuilt())
+	{
+		ReferenceIndex.Build();
+	}
+	else if (ReferenceIndex.IsLoadedFromCache() && !IAssetRegistry::GetChecked().IsLoadingAssets())
+	{
+		ReferenceIndex.RevalidateAgainstRegistry();
+	}
+	else
+	{
+		ReferenceIndex.FlushPendingChanges();
+	}
+
+	return ReferenceIndex;
+}
+
+void FSuperManagerModule::RegisterReferenceIndexDelegates()
+{
+	IAssetRegistry& AssetRegistry =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	// Build once the initial scan is done, after that only the changed packages are touched
+	FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FSuperManagerModule::OnRegistryFilesLoaded);
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSuperManagerModule::OnRegistryAssetChanged);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSuperManagerModule::OnRegistryAssetChanged);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FSuperManagerModule::OnRegistryAssetChanged);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSuperManagerModule::OnRegistryAssetRenamed);
+}
+
+void FSuperManagerModule::UnregisterReferenceIndexDelegates()
+{
+	FAssetRegistryModule* AssetRegistryModule =
+		FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+	if (!AssetRegistryModule) return;
+
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+
+	AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+	AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+	AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+	AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+}
+
+void FSuperManagerModule::OnRegistryFilesLoaded()
+{
+	if (ReferenceIndex.IsLoadedFromCache())
+	{
+		ReferenceIndex.RevalidateAgainstRegistry();
+	}
+	else
+	{
+		ReferenceIndex.Build();
+	}
+}
+
+void FSuperManagerModule::OnRegistryAssetChanged(const FAssetData& AssetData)
+{
+	ReferenceIndex.MarkPackageDirty(AssetData.PackageName);
+
+	if (AssetData.IsRedirector())
+	{
+		RedirectorFixup.NotifyRedirectorsChanged();
+	}
+}
+
+void FSuperManagerModule::OnRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	ReferenceIndex.MarkPackageDirty(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+	ReferenceIndex.MarkPackageDirty(AssetData.PackageName);
+
+	// A rename leaves a redirector behind at the old path
+	RedirectorFixup.NotifyRedirectorsChanged();
 }
 
 #pragma endregion
@@ -402,8 +681,24 @@ void FSuperManagerModule::ShutdownModule()
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
-	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(FName("AdvancedDeletion"));
-	FSuperManagerStyle::ShutDown();
+	UnregisterReferenceIndexDelegates();
+
+	// A graph still waiting for revalidation is exactly what is on disk already
+	if (!ReferenceIndex.IsLoadedFromCache())
+	{
+		ReferenceIndex.SaveToCache(FSuperManagerReferenceIndex::GetDefaultCacheFilename());
+	}
+
+	if (ContentHashCache.IsDirty())
+	{
+		ContentHashCache.SaveToCache(FSuperManagerContentHashCache::GetDefaultCacheFilename());
+	}
+
+	if (!IsRunningCommandlet())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(FName("AdvancedDeletion"));
+		FSuperManagerStyle::ShutDown();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
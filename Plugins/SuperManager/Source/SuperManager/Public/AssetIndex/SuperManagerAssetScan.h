@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include <atomic>
+
+/**
+ * Runs a per package predicate over rows of an asset table on a worker thread.
+ * Matches are handed back to the game thread in batches so the list can fill while the scan is running.
+ * The worker only reads package names, sizes it reads are written into the table on the game thread.
+ */
+class FSuperManagerAssetScan : public TSharedFromThis<FSuperManagerAssetScan>
+{
+public:
+	typedef TFunction<bool(FName PackageName)> FPackagePredicate;
+
+	/** With bInGatherPackageSizes the worker also reads the package size of every match */
+	FSuperManagerAssetScan(const TSharedRef<FSuperManagerAssetTable>& InAssetTable, const TArray<FSuperManagerAssetRowId>& InRowsToScan,
+		FPackagePredicate InPredicate, bool bInGatherPackageSizes = false);
+	~FSuperManagerAssetScan();
+
+	/** Work the predicate depends on, run on the worker before the first row. Set before Start */
+	void SetPrepare(TFunction<void()> InPrepare) { Prepare = MoveTemp(InPrepare); }
+
+	void Start();
+	void Cancel();
+
+	bool IsCancelled() const { return bCancelRequested; }
+
+	/** True once the worker is done and every match has been consumed */
+	bool IsComplete() const;
+
+	/** 0 to 1 */
+	float GetProgress() const;
+
+	/** Game thread. Move at most MaxResults matches found since the last call into OutResults, their sizes into the table */
+	void ConsumeResults(TArray<FSuperManagerAssetRowId>& OutResults, int32 MaxResults);
+
+private:
+	void Run();
+
+	TSharedRef<FSuperManagerAssetTable> AssetTable;
+	TArray<FSuperManagerAssetRowId> RowsToScan;
+	FPackagePredicate Predicate;
+	TFunction<void()> Prepare;
+	int32 NumWorkers;
+	bool bGatherPackageSizes;
+
+	mutable FCriticalSection PendingResultsLock;
+	TArray<FSuperManagerAssetRowId> PendingResults;
+	TMap<FName, FSuperManagerPackageSize> PendingPackageSizes;
+
+	std::atomic<int32> NumScanned { 0 };
+	std::atomic<bool> bCancelRequested { false };
+	std::atomic<bool> bWorkerFinished { false };
+
+	TFuture<void> ScanFuture;
+};
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+
+/**
+ * A SuperManager.Benchmark* console command : registers the command, times passes and logs one aligned line per pass.
+ * Declared as a static in the benchmark's file, Run receives the command and its console arguments.
+ */
+class FSuperManagerBenchmark
+{
+public:
+	typedef void (*FRunFunction)(const FSuperManagerBenchmark& Benchmark, const TArray<FString>& Args);
+
+	static constexpr int32 DefaultNumIterations = 3;
+
+	FSuperManagerBenchmark(const TCHAR* InCommandName, const TCHAR* Help, FRunFunction Run);
+
+	/** Best wall time of NumIterations runs of Pass, in seconds. OutResult is what the last run returned */
+	template<typename ResultType, typename PassType>
+	static double TimePass(const PassType& Pass, ResultType& OutResult, int32 NumIterations = DefaultNumIterations)
+	{
+		double BestSeconds = TNumericLimits<double>::Max();
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const double StartSeconds = FPlatformTime::Seconds();
+			OutResult = Pass();
+			BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartSeconds);
+		}
+
+		return BestSeconds;
+	}
+
+	/** "<Command> : <PassName> <Details>", pass names padded so the lines of one run line up */
+	void LogResult(const TCHAR* PassName, const FString& Details) const;
+
+	void LogMessage(const FString& Message) const;
+
+	/** First console argument as a package path, /Game without one */
+	static FString GetPackagePathArgument(const TArray<FString>& Args);
+
+private:
+	const TCHAR* CommandName;
+	FAutoConsoleCommand ConsoleCommand;
+};
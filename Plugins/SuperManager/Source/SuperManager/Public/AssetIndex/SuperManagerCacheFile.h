@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Reading the cache files SuperManager saves between sessions. A truncated or corrupt file fails the read instead of allocating */
+namespace SuperManagerCacheFile
+{
+	/** Counts read from the file are trusted only if that many elements fit in what is left of it */
+	bool FitsInRemaining(FArchive& Reader, int64 Count, int64 ElementBytes);
+
+	/** FString read, once its length is known to fit in the file */
+	bool ReadString(FArchive& Reader, FString& OutString);
+}
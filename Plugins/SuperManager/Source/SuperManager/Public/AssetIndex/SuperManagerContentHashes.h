@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include <atomic>
+
+/**
+ * What a package holds, without its name. Two packages with equal hashes have the same exports, the same names
+ * and imports behind them and the same bulk data : copies that differ only in their own path and asset name
+ */
+struct FSuperManagerContentHash
+{
+	uint64 Hash = 0;
+	int64 PayloadBytes = 0;
+
+	// Packages that could not be read, or with nothing past their header
+	bool IsValid() const { return PayloadBytes > 0; }
+
+	bool operator==(const FSuperManagerContentHash& Other) const { return Hash == Other.Hash && PayloadBytes == Other.PayloadBytes; }
+	bool operator!=(const FSuperManagerContentHash& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FSuperManagerContentHash& ContentHash) { return static_cast<uint32>(ContentHash.Hash); }
+};
+
+/**
+ * Content hashes of package files, kept while a file keeps its timestamp and size and saved between sessions,
+ * so only packages changed since the last scan are read again. Packages are read as files, never loaded.
+ * Lookups and hashing may run on worker threads.
+ */
+class FSuperManagerContentHashCache
+{
+public:
+	/** Cached hash while the package file is unchanged, otherwise the file is read and hashed again */
+	FSuperManagerContentHash GetContentHash(FName PackageName);
+
+	/** Last hash of PackageName without looking at the file, invalid if it was never hashed */
+	FSuperManagerContentHash FindContentHash(FName PackageName) const;
+
+	/**
+	 * Stream a package file through CityHash in chunks : the names and imports its exports use, the exports, then
+	 * the bulk data (texture mips and source art, mesh source models, sound waves) inline, in the payload trailer and
+	 * in split files. The rest of the header is skipped, it holds the package and asset names
+	 */
+	static FSuperManagerContentHash HashPackageFile(const FString& PackageFilename);
+
+	int32 Num() const;
+	bool IsDirty() const { return bDirty; }
+
+#pragma region PersistentCache
+
+	bool LoadFromCache(const FString& CacheFilename);
+	bool SaveToCache(const FString& CacheFilename);
+
+	static FString GetDefaultCacheFilename();
+
+#pragma endregion
+
+private:
+	struct FCacheEntry
+	{
+		// Validation key, the package file as it was when hashed
+		int64 TimeStamp = 0;
+		int64 FileSize = 0;
+
+		FSuperManagerContentHash ContentHash;
+	};
+
+	TMap<FName, FCacheEntry> Entries;
+	mutable FRWLock CacheLock;
+
+	std::atomic<bool> bDirty { false };
+};
+
+namespace SuperManagerContentHashes
+{
+	/** First row of each package among Rows, in order. Assets of one package share one hash */
+	void GatherUniquePackages(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		TArray<FSuperManagerAssetRowId>& OutPackageRows);
+
+	/** Hash the package of every row through Cache, each package once, in parallel. Returns how many have a payload */
+	int32 HashPackages(FSuperManagerContentHashCache& Cache, const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& Rows, int32 NumWorkers);
+
+	/**
+	 * Group the rows whose package has the same cached hash as another package, copies next to each other.
+	 * Rows never hashed are left out, and so are assets sharing nothing but their own package
+	 */
+	void GroupDuplicateRows(const FSuperManagerContentHashCache& Cache, const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& Rows, TArray<FSuperManagerAssetRowId>& OutDuplicateRows);
+}
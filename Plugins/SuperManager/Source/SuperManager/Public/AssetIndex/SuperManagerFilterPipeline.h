@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+
+// Cheapest checks first, later stages only look at the rows that made it through the earlier ones
+enum class ESuperManagerFilterStage : uint8
+{
+	Class,
+	Unused,
+	Age,
+	Size,
+	SameName,
+	Path,
+
+	Num
+};
+
+// Stacked row filters over an asset table, applied on top of the rows a listing condition produced.
+//
+// Every stage keeps the bitset of rows it let through. Changing one stage's setting only re-evaluates
+// that stage and the ones after it, starting from the cached output of the stage before it.
+// A disabled stage passes its input through unchanged.
+class SUPERMANAGER_API FSuperManagerFilterPipeline
+{
+public:
+	/** Only rows of this class, INDEX_NONE for any */
+	void SetClassIndex(int32 InClassIndex);
+
+	/** Only rows nothing references */
+	void SetUnusedOnly(bool bInUnusedOnly);
+
+	/** Only rows whose package was not modified for this many days, 0 for any */
+	void SetMinAgeDays(int32 InMinAgeDays);
+
+	/** Only rows whose package is at least this large on disk, 0 for any. Rows of unknown size do not pass */
+	void SetMinSizeBytes(int64 InMinSizeBytes);
+
+	/** Only rows whose asset name another row of the table also has */
+	void SetSameNameOnly(bool bInSameNameOnly);
+
+	/** Only rows whose package name matches this wildcard (* and ?), empty for any */
+	void SetPathWildcard(const FString& InPathWildcard);
+
+	bool IsStageEnabled(ESuperManagerFilterStage Stage) const;
+	bool HasEnabledStages() const;
+
+	/** Rows entering the first stage. Every stage is evaluated again */
+	void SetSourceRows(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& SourceRows);
+
+	/** Re-evaluate the stages changed since the last update and the ones after them. Returns how many ran */
+	int32 Update(const FSuperManagerAssetTable& AssetTable);
+
+	/**
+	 * Push single rows through every stage, for rows streamed in by a scan or touched by a live update.
+	 * bInSource says whether they are rows of the listing condition
+	 */
+	void UpdateRows(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows, bool bInSource);
+
+	/** Rows were added to or removed from the table, the same name stage has to count names again */
+	void MarkTableChanged() { bNameCountsDirty = true; }
+
+	/** Went through every stage, as of the last update */
+	bool Passes(FSuperManagerAssetRowId Row) const;
+
+private:
+	static constexpr int32 NumStages = static_cast<int32>(ESuperManagerFilterStage::Num);
+
+	void MarkDirty(ESuperManagerFilterStage Stage);
+
+	/** Rows of the table the pipeline does not know yet enter nowhere */
+	void GrowTo(int32 NumRows);
+
+	void EvaluateStage(const FSuperManagerAssetTable& AssetTable, int32 StageIndex);
+	bool PassesStage(const FSuperManagerAssetTable& AssetTable, int32 StageIndex, FSuperManagerAssetRowId Row) const;
+
+	const TBitArray<>& GetStageInput(int32 StageIndex) const { return StageIndex == 0 ? SourceBits : StageOutputs[StageIndex - 1]; }
+
+	/** Rows per asset name over the whole table, for the same name stage. Only when the table changed */
+	void CountNames(const FSuperManagerAssetTable& AssetTable);
+
+	TBitArray<> SourceBits;
+	TBitArray<> StageOutputs[NumStages];
+
+	// NumStages when every cached output is current
+	int32 FirstDirtyStage = 0;
+
+	int32 ClassIndex = INDEX_NONE;
+	bool bUnusedOnly = false;
+	int32 MinAgeDays = 0;
+	int64 MaxModifiedTicks = 0;
+	int64 MinSizeBytes = 0;
+	bool bSameNameOnly = false;
+	FString PathWildcard;
+
+	TMap<FName, int32> NameCounts;
+	bool bNameCountsDirty = true;
+};
@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSuperManagerPathExclusion;
+
+namespace SuperManagerFolderTree
+{
+	/**
+	 * FolderPaths without trailing slashes and without the folders already under another one of them,
+	 * so every asset belongs to at most one of the roots. Sorted
+	 */
+	void CollapseNestedFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutRootPaths);
+
+	/**
+	 * Empty folders under FolderPath, from the registry's cached path list and one pass over its assets.
+	 * Only the topmost folder of an empty subtree is reported, its children go with it.
+	 * Excluded folders are never reported and keep their parents from being reported either
+	 */
+	void FindEmptyFolderRoots(const FString& FolderPath, const FSuperManagerPathExclusion& Exclusion,
+		TArray<FString>& OutEmptyFolderPaths);
+
+	/**
+	 * Delete FolderPaths and their sub folders from disk, deepest first, without a per folder refresh.
+	 * A folder still holding files is left alone and reported in OutFailedFolderPaths.
+	 * The registry and the content browser get one path removal per deleted subtree at the end.
+	 * Returns the number of folders deleted, sub folders included
+	 */
+	int32 DeleteFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutFailedFolderPaths);
+}
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+
+/** Rows sharing a key, a range of the grouped rows */
+struct FSuperManagerRowGroup
+{
+	// Asset name of the group's first row, the shared name for name groups
+	FName Name;
+	int32 FirstRow = 0;
+	int32 NumRows = 0;
+};
+
+namespace SuperManagerNameGroups
+{
+	/**
+	 * Group Rows by KeyOfRow(Row) in one pass : one hash lookup per row, then every row is written straight
+	 * to its slot. Linear however many rows share a key.
+	 * Groups come in order of first appearance and keep the order of their rows.
+	 * Groups smaller than MinGroupSize are left out, 2 keeps only the keys found more than once
+	 */
+	template<typename KeyType, typename KeyOfRowType>
+	void GroupRowsByKey(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		int32 MinGroupSize, const KeyOfRowType& KeyOfRow, TArray<FSuperManagerAssetRowId>& OutGroupedRows,
+		TArray<FSuperManagerRowGroup>& OutGroups)
+	{
+		OutGroupedRows.Reset();
+		OutGroups.Reset();
+
+		TMap<KeyType, int32> GroupIndexByKey;
+		GroupIndexByKey.Reserve(Rows.Num());
+
+		TArray<FSuperManagerRowGroup> Groups;
+		TArray<int32> GroupOfRow;
+		GroupOfRow.SetNumUninitialized(Rows.Num());
+
+		for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			int32& GroupIndex = GroupIndexByKey.FindOrAdd(KeyOfRow(Rows[RowIndex]), INDEX_NONE);
+			if (GroupIndex == INDEX_NONE)
+			{
+				GroupIndex = Groups.Num();
+				Groups.AddDefaulted_GetRef().Name = AssetTable.GetAssetName(Rows[RowIndex]);
+			}
+
+			GroupOfRow[RowIndex] = GroupIndex;
+			++Groups[GroupIndex].NumRows;
+		}
+
+		// Kept groups get their range, the rows of the others have no slot
+		TArray<int32> NextSlots;
+		NextSlots.Init(INDEX_NONE, Groups.Num());
+
+		int32 NumGroupedRows = 0;
+
+		for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+		{
+			FSuperManagerRowGroup& Group = Groups[GroupIndex];
+			if (Group.NumRows < MinGroupSize) continue;
+
+			Group.FirstRow = NumGroupedRows;
+			NextSlots[GroupIndex] = NumGroupedRows;
+			NumGroupedRows += Group.NumRows;
+
+			OutGroups.Add(Group);
+		}
+
+		OutGroupedRows.SetNumUninitialized(NumGroupedRows);
+
+		for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			int32& NextSlot = NextSlots[GroupOfRow[RowIndex]];
+
+			if (NextSlot != INDEX_NONE)
+			{
+				OutGroupedRows[NextSlot++] = Rows[RowIndex];
+			}
+		}
+	}
+
+	/** GroupRowsByKey on the asset name, no string is built. FName compares case insensitively, like the name strings did */
+	void GroupRowsByName(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		int32 MinGroupSize, TArray<FSuperManagerAssetRowId>& OutGroupedRows, TArray<FSuperManagerRowGroup>& OutGroups);
+}
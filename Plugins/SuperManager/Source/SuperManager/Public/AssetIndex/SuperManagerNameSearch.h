@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+
+// Case insensitive substring search over the object paths of an asset table.
+//
+// Every row's lower case path is kept as UTF-8 and indexed by the 3 byte sequences (trigrams) it contains.
+// A query of 3 or more bytes only looks at rows holding all of its trigrams, starting from the rarest one,
+// then checks the candidates with a plain substring test. Shorter queries scan the candidates directly.
+// Passing the previous matches as candidates lets a growing query narrow the last result instead of starting over.
+class SUPERMANAGER_API FSuperManagerNameSearch
+{
+public:
+	void Build(const FSuperManagerAssetTable& AssetTable);
+	void Reset();
+
+	/** Index a row appended to the table after Build. Rows have to be added in order */
+	void AddRow(const FSuperManagerAssetTable& AssetTable, FSuperManagerAssetRowId Row);
+
+	/** Substring test of a single row, no index lookup */
+	bool Matches(FSuperManagerAssetRowId Row, const FString& Query) const;
+
+	int32 Num() const { return TextOffsets.Num(); }
+
+	/**
+	 * Rows whose path contains Query, in row order. An empty query matches every candidate.
+	 * Candidates, when given, must be in row order and limit the search to those rows
+	 */
+	void Search(const FString& Query, const TArray<FSuperManagerAssetRowId>* Candidates,
+		TArray<FSuperManagerAssetRowId>& OutRows) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static uint32 MakeTrigram(const ANSICHAR* Text)
+	{
+		return static_cast<uint8>(Text[0]) | static_cast<uint8>(Text[1]) << 8 | static_cast<uint8>(Text[2]) << 16;
+	}
+
+	const ANSICHAR* GetText(int32 RowIndex) const { return TextBuffer.GetData() + TextOffsets[RowIndex]; }
+
+	bool RowContains(int32 RowIndex, const ANSICHAR* LowerQuery) const;
+
+	// Null terminated lower case paths, one after the other
+	TArray<ANSICHAR> TextBuffer;
+	TArray<int32> TextOffsets;
+
+	// Rows holding each trigram, in row order
+	TMap<uint32, int32> PostingIndexByTrigram;
+	TArray<TArray<int32>> Postings;
+};
@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSuperManagerReferenceIndex;
+
+/**
+ * Deletes packages the registry already proved unreferenced straight from disk, without loading them.
+ * Everything that can not take this path (loaded, still referenced, under source control, sharing a
+ * package with assets that are not being deleted, or any package while the registry is still scanning)
+ * goes through ObjectTools::DeleteAssets as before.
+ */
+namespace SuperManagerPackageDeletion
+{
+	/**
+	 * Split AssetsToDelete into package names safe to delete from disk and assets needing the regular path.
+	 * A package is safe once nothing references it : no registry edge, hard or soft, and no unsaved object in memory
+	 */
+	void PartitionAssets(const TArray<FAssetData>& AssetsToDelete, const FSuperManagerReferenceIndex& ReferenceIndex,
+		TArray<FName>& OutFastPathPackages, TArray<FAssetData>& OutFallbackAssets);
+
+	/**
+	 * Remove the package files with their split files and tell the registry in batches. Returns the number of packages deleted.
+	 * OutFailedPackages had a file missing, read only or locked and were left untouched. OutPartlyDeletedPackages lost
+	 * their package file but kept split files that could not be removed, they must not be loaded again
+	 */
+	int32 DeletePackageFiles(const TArray<FName>& PackageNames, TArray<FName>& OutFailedPackages,
+		TArray<FName>& OutPartlyDeletedPackages);
+}
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+/** What deleting a package frees */
+struct FSuperManagerPackageSize
+{
+	/** .uasset / .umap plus split .uexp / .ubulk files */
+	int64 DiskBytes = 0;
+
+	/**
+	 * Disk size without the editor package header (name, import and export tables, thumbnails,
+	 * registry tags). Exports and bulk data are assumed to ship as they are, so this is an upper bound
+	 */
+	int64 EstimatedCookedBytes = 0;
+};
+
+/** Reclaimable bytes under one folder, counting every package in its subtree once */
+struct FSuperManagerFolderSize
+{
+	FString FolderPath;
+	FSuperManagerPackageSize Size;
+	int32 NumPackages = 0;
+};
+
+class FSuperManagerAssetTable;
+struct FSuperManagerAssetRowId;
+
+namespace SuperManagerPackageSizes
+{
+	/** Split .uexp / .ubulk / .uptnl files next to PackageFilename that exist on disk */
+	void GetSplitPackageFiles(const FString& PackageFilename, TArray<FString>& OutFilenames);
+
+	/** File stat and package summary only, the package is never loaded */
+	FSuperManagerPackageSize ReadPackageSize(FName PackageName);
+
+	/** Read the size of every package in PackageNames not already in InOutPackageSizes, in parallel */
+	void GatherPackageSizes(const TArray<FName>& PackageNames,
+		TMap<FName, FSuperManagerPackageSize>& InOutPackageSizes, int32 NumWorkers);
+
+	/** Same, for the rows of AssetTable whose size is not known yet. Sizes are written into the table */
+	void GatherPackageSizes(FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows, int32 NumWorkers);
+
+	/** Sum known package sizes into every ancestor folder, largest folder first */
+	void RollUpByFolder(const FSuperManagerAssetTable& AssetTable, const TArray<FSuperManagerAssetRowId>& Rows,
+		TArray<TSharedPtr<FSuperManagerFolderSize>>& OutFolderSizes);
+}
@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
+
+namespace SuperManagerParallel
+{
+	// Below this many items per worker a sort stays on the calling thread
+	constexpr int32 MinItemsPerSortChunk = 4096;
+
+	/** Worker count from USuperManagerSettings::ScanWorkerCount, 0 resolved to the number of logical cores */
+	int32 GetNumWorkers();
+
+	/**
+	 * Run Body(ItemIndex, ChunkResults) over [0, NumItems) with at most NumWorkers tasks.
+	 * Every task owns one contiguous chunk and chunk results are appended in chunk order,
+	 * so OutResults is identical to what a serial loop would produce.
+	 */
+	template<typename ResultType, typename BodyType>
+	void ParallelGather(int32 NumItems, int32 NumWorkers, TArray<ResultType>& OutResults, const BodyType& Body)
+	{
+		if (NumItems <= 0) return;
+
+		const int32 NumChunks = FMath::Clamp(NumWorkers, 1, NumItems);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(NumItems, NumChunks);
+
+		TArray<TArray<ResultType>> ChunkResults;
+		ChunkResults.SetNum(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 ChunkStart = ChunkIndex * ChunkSize;
+			const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, NumItems);
+
+			for (int32 ItemIndex = ChunkStart; ItemIndex < ChunkEnd; ++ItemIndex)
+			{
+				Body(ItemIndex, ChunkResults[ChunkIndex]);
+			}
+		}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+		for (TArray<ResultType>& Chunk : ChunkResults)
+		{
+			OutResults.Append(MoveTemp(Chunk));
+		}
+	}
+
+	/** Keep the items matching Predicate, in their original order */
+	template<typename ItemType, typename PredicateType>
+	void ParallelFilter(const TArray<ItemType>& Items, TArray<ItemType>& OutMatches, int32 NumWorkers, const PredicateType& Predicate)
+	{
+		ParallelGather(Items.Num(), NumWorkers, OutMatches,
+			[&Items, &Predicate](int32 ItemIndex, TArray<ItemType>& ChunkMatches)
+			{
+				if (Predicate(Items[ItemIndex]))
+				{
+					ChunkMatches.Add(Items[ItemIndex]);
+				}
+			});
+	}
+
+	/**
+	 * Stable sort. Each worker sorts one chunk, then neighbouring runs are merged in pairs,
+	 * one parallel pass per doubling of the run length. Equal items keep their order
+	 */
+	template<typename ItemType, typename LessType>
+	void ParallelStableSort(TArray<ItemType>& Items, int32 NumWorkers, const LessType& Less)
+	{
+		const int32 NumItems = Items.Num();
+		const int32 NumChunks = FMath::Clamp(NumWorkers, 1, FMath::Max(NumItems / MinItemsPerSortChunk, 1));
+
+		if (NumChunks == 1)
+		{
+			Algo::StableSort(Items, Less);
+			return;
+		}
+
+		const int32 ChunkSize = FMath::DivideAndRoundUp(NumItems, NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 ChunkStart = ChunkIndex * ChunkSize;
+			const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, NumItems);
+
+			if (ChunkStart < ChunkEnd)
+			{
+				Algo::StableSort(TArrayView<ItemType>(Items.GetData() + ChunkStart, ChunkEnd - ChunkStart), Less);
+			}
+		});
+
+		TArray<ItemType> Scratch;
+		Scratch.SetNum(NumItems);
+
+		TArray<ItemType>* Source = &Items;
+		TArray<ItemType>* Dest = &Scratch;
+
+		for (int32 RunSize = ChunkSize; RunSize < NumItems; RunSize *= 2)
+		{
+			const int32 NumMerges = FMath::DivideAndRoundUp(NumItems, RunSize * 2);
+
+			ParallelFor(NumMerges, [&](int32 MergeIndex)
+			{
+				const ItemType* SourceItems = Source->GetData();
+				ItemType* DestItems = Dest->GetData();
+
+				const int32 LeftEnd = FMath::Min(MergeIndex * RunSize * 2 + RunSize, NumItems);
+				const int32 RightEnd = FMath::Min(LeftEnd + RunSize, NumItems);
+
+				int32 Left = MergeIndex * RunSize * 2;
+				int32 Right = LeftEnd;
+				int32 Out = Left;
+
+				// Ties are taken from the left run, that is what keeps the sort stable
+				while (Left < LeftEnd && Right < RightEnd)
+				{
+					DestItems[Out++] = Less(SourceItems[Right], SourceItems[Left]) ? SourceItems[Right++] : SourceItems[Left++];
+				}
+
+				while (Left < LeftEnd) DestItems[Out++] = SourceItems[Left++];
+				while (Right < RightEnd) DestItems[Out++] = SourceItems[Right++];
+			});
+
+			Swap(Source, Dest);
+		}
+
+		if (Source != &Items)
+		{
+			Items = MoveTemp(*Source);
+		}
+	}
+}
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Package path exclusion rules compiled into a trie of folder names.
+//
+// A rule is an absolute path and excludes that folder and everything under it. Segments match whole
+// folder names, so "/Game/Developers" does not exclude "/Game/MyDevelopersHub" :
+//		/Game/Developers			literal folder
+//		/*/Collections				'*' matches any single folder
+//		/**/__ExternalActors__		'**' matches any number of folders, including none
+//		/Game/Temp_*				'*' and '?' inside a segment are wildcards on that folder name
+class SUPERMANAGER_API FSuperManagerPathExclusion
+{
+public:
+	/** Replace every rule. Rules that are not absolute paths are logged and skipped */
+	void Compile(const TArray<FString>& Rules);
+
+	bool IsCompiledFrom(const TArray<FString>& Rules) const { return CompiledRules == Rules; }
+
+	/** Result is cached per package path, safe to call from scan workers */
+	bool IsPackagePathExcluded(FName PackagePath) const;
+
+	/** Uncached. Accepts folder paths with or without a trailing slash */
+	bool IsPathExcluded(FStringView Path) const;
+
+private:
+	struct FNode
+	{
+		TMap<FName, int32> LiteralChildren;
+		TArray<TPair<FString, int32>> WildcardChildren;
+		int32 AnySegmentChild = INDEX_NONE;
+		int32 AnyDepthChild = INDEX_NONE;
+
+		// Reached through '**', stays active while any number of folders are consumed
+		bool bAnyDepth = false;
+
+		// A rule ends here
+		bool bTerminal = false;
+	};
+
+	typedef TArray<int32, TInlineAllocator<8>> FActiveNodes;
+
+	int32 FindOrAddChild(int32 ParentIndex, const FString& Segment);
+	void AddActiveNode(int32 NodeIndex, FActiveNodes& OutActiveNodes) const;
+
+	TArray<FNode> Nodes;
+	TArray<FString> CompiledRules;
+
+	mutable FRWLock CacheLock;
+	mutable TMap<FName, bool> PackagePathCache;
+};
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One redirector and the chain of redirectors it goes through before reaching a real asset */
+struct FSuperManagerRedirectorChain
+{
+	FSoftObjectPath Redirector;
+
+	// Redirectors followed after this one, in order
+	TArray<FSoftObjectPath> FollowingRedirectors;
+
+	FSoftObjectPath FinalTarget;
+
+	// Packages other than redirectors referencing this redirector
+	int32 NumReferencers = 0;
+
+	// The chain loops back on itself, there is no final target
+	bool bCycle = false;
+
+	int32 GetChainLength() const { return FollowingRedirectors.Num() + 1; }
+};
+
+namespace SuperManagerRedirectorAudit
+{
+	/** Every redirector under any of FolderPaths and its chain, from registry tags only. Longest chains first */
+	void BuildRedirectorChains(const TArray<FString>& FolderPaths, TArray<FSuperManagerRedirectorChain>& OutChains);
+
+	/**
+	 * Fix up every redirector of every chain, the ones outside the audited folders too, with a single
+	 * FixupReferencers call in one transaction. Referencers are saved pointing at the final targets.
+	 * Cycles are skipped. Returns the number of redirectors handed to the fixup
+	 */
+	int32 FixRedirectorChains(const TArray<FSuperManagerRedirectorChain>& Chains, bool bCheckoutDialogPrompt);
+
+	/** One line summary for dialogs and logs */
+	FString DescribeChains(const TArray<FSuperManagerRedirectorChain>& Chains);
+}
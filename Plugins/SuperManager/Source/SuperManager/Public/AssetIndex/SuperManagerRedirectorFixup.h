@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixes up only the redirectors that matter to a set of folders : the ones inside them and the ones pointing
+ * into them. Candidates are picked from registry data, only those are loaded. Nothing is done when no
+ * redirector was added, removed or changed since the same scope was last fixed up.
+ */
+class SUPERMANAGER_API FSuperManagerRedirectorFixup
+{
+public:
+	/** Called for every registry event on an ObjectRedirector */
+	void NotifyRedirectorsChanged() { ++RedirectorGeneration; }
+
+	uint64 GetRedirectorGeneration() const { return RedirectorGeneration; }
+
+	/** Returns the number of redirectors fixed up */
+	int32 FixUpRedirectors(const TArray<FString>& FolderPaths);
+
+private:
+	uint64 RedirectorGeneration = 1;
+
+	// Scope key (sorted folder list) to the generation it was last fixed up at
+	TMap<FString, uint64> FixedGenerations;
+};
@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Reverse-reference index over the AssetRegistry package dependency graph.
+ * Built in one pass (linear in packages + edges) so that asking whether a package
+ * is referenced is a single map lookup instead of a registry query per asset.
+ * Lookups may run on worker threads, every update happens on the game thread under the write lock.
+ */
+class FSuperManagerReferenceIndex
+{
+public:
+
+	/** Walk every on disk package once and record its dependency / referencer edges */
+	void Build();
+	void Reset();
+
+	bool IsBuilt() const { return bIsBuilt; }
+	int32 GetNumPackages() const { return Nodes.Num(); }
+
+	/** Number of other packages referencing this package. 0 for unknown packages */
+	int32 GetReferencerCount(FName PackageName) const;
+	bool IsPackageUnused(FName PackageName) const { return GetReferencerCount(PackageName) == 0; }
+
+	void GetReferencers(FName PackageName, TArray<FName>& OutReferencers) const;
+
+	/** Package file modification time in ticks, as last seen by the index. 0 for unknown packages */
+	int64 GetPackageTimeStamp(FName PackageName) const;
+
+	/**
+	 * Mark-and-sweep : set the bit of every package reachable from the roots through dependency edges, one bit per node.
+	 * Only reads the index, so every caller marks into its own bits and may do it on a worker thread
+	 */
+	void MarkReachableFrom(const TArray<FName>& RootPackages, TBitArray<>& OutReachableNodes) const;
+
+	/** Packages unknown to the index, or added after the marking, are reported reachable so they are never flagged by mistake */
+	bool IsPackageReachable(FName PackageName, const TBitArray<>& ReachableNodes) const;
+
+#pragma region IncrementalUpdate
+
+	/** Queue a package whose registry entry was added, updated, renamed or removed. Ignored until built */
+	void MarkPackageDirty(FName PackageName);
+
+	/** Re-link only the queued packages. Cost is proportional to what changed since the last flush */
+	void FlushPendingChanges();
+
+	bool HasPendingChanges() const { return DirtyPackages.Num() > 0; }
+
+	/** Broadcast on the game thread after a flush, with every package whose referencers may have changed */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnReferencersChanged, const TArray<FName>& /*ChangedPackages*/);
+	FOnReferencersChanged& OnReferencersChanged() { return ReferencersChangedDelegate; }
+
+#pragma endregion
+
+#pragma region PersistentCache
+
+	/** Read the graph saved by a previous session. The index is usable right away, before the registry scan ends */
+	bool LoadFromCache(const FString& CacheFilename);
+	bool SaveToCache(const FString& CacheFilename) const;
+
+	/** Compare each registry package with its cached timestamp and hash, re-link only the ones that changed */
+	void RevalidateAgainstRegistry();
+
+	bool IsLoadedFromCache() const { return bLoadedFromCache; }
+
+	static FString GetDefaultCacheFilename();
+
+#pragma endregion
+
+private:
+
+	struct FPackageNode
+	{
+		FName PackageName;
+
+		// Indices into Nodes
+		TArray<int32> Dependencies;
+		TArray<int32> Referencers;
+
+		// Removed packages keep their slot so indices held by other nodes stay valid
+		bool bExists = true;
+
+		// Validation key for the persistent cache
+		int64 TimeStamp = 0;
+		uint64 PackageHash = 0;
+	};
+
+	int32 FindOrAddNode(FName PackageName);
+
+	// Callers hold the write lock
+	void ResetNodes();
+	void RelinkDirtyPackages(TArray<FName>* OutChangedPackages = nullptr);
+
+	void LinkDependencies(class IAssetRegistry& AssetRegistry, int32 NodeIndex, TArray<FName>& ScratchNames);
+	void LinkReferencers(class IAssetRegistry& AssetRegistry, int32 NodeIndex, TArray<FName>& ScratchNames);
+	void UnlinkDependencies(int32 NodeIndex);
+
+	static void ReadPackageKey(class IAssetRegistry& AssetRegistry, FName PackageName, int64& OutTimeStamp, uint64& OutPackageHash);
+	void RefreshPackageKeys(class IAssetRegistry& AssetRegistry, const TArray<int32>& NodeIndices);
+	bool ReadCache(const uint8* CacheData, int64 CacheSize);
+
+	TArray<FPackageNode> Nodes;
+	TMap<FName, int32> PackageToNodeIndex;
+
+	TSet<FName> DirtyPackages;
+
+	FOnReferencersChanged ReferencersChangedDelegate;
+
+	mutable FRWLock IndexLock;
+
+	bool bIsBuilt = false;
+	bool bLoadedFromCache = false;
+};
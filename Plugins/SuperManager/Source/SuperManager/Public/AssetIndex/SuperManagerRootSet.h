@@ -0,0 +1,11 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SuperManagerRootSet
+{
+	/** Collect the root packages of the reachability sweep, as configured in USuperManagerSettings */
+	void GatherRootPackages(TArray<FName>& OutRootPackages);
+}
@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SuperManagerAuditCommandlet.generated.h"
+
+/**
+ * Headless SuperManager cleanup report, for CI :
+ *
+ * UnrealEditor-Cmd <Project> -run=SuperManagerAudit -nullrhi
+ *		[-Path=/Game]					folder to audit
+ *		[-Report=<file>.json|.csv]		default Saved/SuperManager/AuditReport.json
+ *		[-Checks=Redirectors,Unused,EmptyFolders,SameName]	ContentDuplicates too on request, it reads every package
+ *		[-Apply]						fix redirector chains, delete unused assets and empty folders after reporting them
+ */
+UCLASS()
+class SUPERMANAGER_API USuperManagerAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USuperManagerAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
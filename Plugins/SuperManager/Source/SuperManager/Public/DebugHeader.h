@@ -3,6 +3,7 @@
 #include "Misc/MessageDialog.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
+#include "Framework/Application/SlateApplication.h"
 
 namespace DebugHeader 
 {
@@ -19,9 +20,29 @@ namespace DebugHeader
 		UE_LOG(LogTemp, Warning, TEXT("%s"), *Message);
 	}
 
+	// Commandlets and unattended runs can not answer a modal dialog
+	static bool IsHeadless()
+	{
+		return IsRunningCommandlet() || FApp::IsUnattended();
+	}
+
 	static EAppReturnType::Type ShowMsgDialog(EAppMsgType::Type MsgType, const FString& Message,
 		bool bShowMessageWarning = true)
 	{
+		if (IsHeadless())
+		{
+			// Always take the answer that does nothing destructive
+			PrintLog(Message);
+
+			switch (MsgType)
+			{
+			case EAppMsgType::YesNo:		return EAppReturnType::No;
+			case EAppMsgType::OkCancel:		return EAppReturnType::Cancel;
+			case EAppMsgType::YesNoCancel:	return EAppReturnType::Cancel;
+			default:						return EAppReturnType::Ok;
+			}
+		}
+
 		if (bShowMessageWarning)
 		{
 			FText MsgTitle = FText::FromString(TEXT("Warning"));
@@ -35,6 +56,12 @@ namespace DebugHeader
 
 	static void ShowNotifyInfo(const FString& Message)
 	{
+		if (IsHeadless() || !FSlateApplication::IsInitialized())
+		{
+			PrintLog(Message);
+			return;
+		}
+
 		FNotificationInfo NotifyInfo(FText::FromString(Message));
 		NotifyInfo.bUseLargeFont = true;
 		NotifyInfo.FadeOutDuration = '7.f';
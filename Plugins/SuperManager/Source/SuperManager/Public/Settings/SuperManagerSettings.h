@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SuperManagerSettings.generated.h"
+
+/**
+ * Project settings for SuperManager. Found under Project Settings > Plugins > Super Manager
+ */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "Super Manager"))
+class SUPERMANAGER_API USuperManagerSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	static const USuperManagerSettings* Get() { return GetDefault<USuperManagerSettings>(); }
+
+	virtual FName GetCategoryName() const override { return FName("Plugins"); }
+
+#pragma region ReachabilityRoots
+
+	// Every map (World asset) in the project is a root
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots")
+	bool bMapsAreRoots = true;
+
+	// Default maps, GameMode and GameInstance classes from Maps & Modes settings are roots
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots")
+	bool bGameModeClassesAreRoots = true;
+
+	// Every PrimaryAssetLabel asset is a root
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots")
+	bool bPrimaryAssetLabelsAreRoots = true;
+
+	// Every package under the packaging "Additional Asset Directories to Cook" is a root
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots")
+	bool bAlwaysCookDirectoriesAreRoots = true;
+
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots", meta = (LongPackageName))
+	TArray<FDirectoryPath> AdditionalRootDirectories;
+
+	UPROPERTY(config, EditAnywhere, Category = "ReachabilityRoots")
+	TArray<FSoftObjectPath> AdditionalRootAssets;
+
+#pragma endregion
+
+#pragma region Exclusions
+
+	// Folders no scan lists, checks or deletes. A rule excludes the folder and everything under it,
+	// '*' matches one folder, '**' any number of folders. See FSuperManagerPathExclusion
+	UPROPERTY(config, EditAnywhere, Category = "Exclusions")
+	TArray<FString> ExcludedPathRules =
+	{
+		TEXT("/**/Developers"),
+		TEXT("/**/Collections"),
+		TEXT("/**/__ExternalActors__"),
+		TEXT("/**/__ExternalObjects__")
+	};
+
+#pragma endregion
+
+#pragma region Performance
+
+	// Number of parallel workers used by asset scans. 0 uses every logical core, 1 runs scans serially
+	UPROPERTY(config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0", ClampMax = "256"))
+	int32 ScanWorkerCount = 0;
+
+#pragma endregion
+};
@@ -3,28 +3,51 @@
 #pragma once
 
 #include "Widgets/SCompoundWidget.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include "AssetIndex/SuperManagerNameSearch.h"
+#include "AssetIndex/SuperManagerFilterPipeline.h"
+#include "AssetIndex/SuperManagerNameGroups.h"
+#include "AssetIndex/SuperManagerContentHashes.h"
+
+// Condition picked in the combo box, the listed rows are the stored rows passing it
+enum class EAdvanceDeletionListing : uint8
+{
+	All,
+	Unused,
+	Unreachable,
+	SameName,
+	ContentDuplicates,
+};
 
 class SAdvanceDeletionTab : public SCompoundWidget
 {
 	SLATE_BEGIN_ARGS(SAdvanceDeletionTab) {}
 
-	SLATE_ARGUMENT(TArray<TSharedPtr<FAssetData>>, AssetsDataToStore)
+	SLATE_ARGUMENT(TSharedPtr<FSuperManagerAssetTable>, AssetTable)
 
-	SLATE_ARGUMENT(FString, CurrentSelectedFolder)
+	SLATE_ARGUMENT(TArray<FString>, SelectedFolders)
 
 	SLATE_END_ARGS()
 
 public:
 	void Construct(const FArguments& InArgs);
+	virtual ~SAdvanceDeletionTab();
 
 private:
-	TArray<TSharedPtr<FAssetData>> StoreAssetsData;
-	TArray<TSharedPtr<FAssetData>> DisplayedAssetsData;
-	TArray<TSharedRef<SCheckBox>> CheckBoxesArray;
-	TArray<TSharedPtr<FAssetData>> AssetsDataToDeleteArray;
+	// Rows hold the asset fields, the lists only hold row ids
+	TSharedPtr<FSuperManagerAssetTable> AssetTable;
+	// Selected folders with nested ones collapsed into their parent
+	TArray<FString> FolderPaths;
+	EAdvanceDeletionListing ListingCondition = EAdvanceDeletionListing::All;
+	TArray<FSuperManagerAssetRowId> StoreRows;
+
+	// Rows found by the listing condition, those of them passing the filter pipeline, and those passing the name search
+	TArray<FSuperManagerAssetRowId> SourceRows;
+	TArray<FSuperManagerAssetRowId> ListedRows;
+	TArray<FSuperManagerAssetRowId> DisplayedRows;
 
-	TSharedRef<SListView<TSharedPtr<FAssetData>>> ConstructAssetListView();
-	TSharedPtr<SListView<TSharedPtr<FAssetData>>> ConstructedAssetListView;
+	TSharedRef<SListView<FSuperManagerAssetRowId>> ConstructAssetListView();
+	TSharedPtr<SListView<FSuperManagerAssetRowId>> ConstructedAssetListView;
 	void RefreshAssetListView();
 
 #pragma region ComboBoxForListingCondition
@@ -41,18 +64,261 @@ private:
 #pragma endregion
 
 
+#pragma region NameSearch
+
+	TSharedRef<SWidget> ConstructSearchBox();
+	void OnSearchTextChanged(const FText& InSearchText);
+
+	/** Rebuild DisplayedRows from ListedRows and the current search matches */
+	void ApplySearchFilter();
+	bool PassesSearch(FSuperManagerAssetRowId Row) const;
+
+	FSuperManagerNameSearch NameSearch;
+	FString SearchText;
+
+	// Matches of SearchText over every row, kept so the next keystroke can narrow them
+	TArray<FSuperManagerAssetRowId> SearchMatches;
+	TBitArray<> SearchMatchedRows;
+#pragma endregion
+
+
+#pragma region FilterPipeline
+
+	TSharedRef<SWidget> ConstructFilterBar();
+
+	// Class
+	TSharedRef<SWidget> ConstructClassFilter();
+	void OnClassFilterOpening();
+	TSharedRef<SWidget> OnGenerateClassFilterItem(TSharedPtr<int32> ClassIndex);
+	void OnClassFilterChanged(TSharedPtr<int32> ClassIndex, ESelectInfo::Type InSelectInfo);
+	FText GetClassFilterText(int32 ClassIndex) const;
+	FText GetSelectedClassFilterText() const;
+
+	TArray<TSharedPtr<int32>> ClassFilterItems;
+	int32 ClassFilterIndex = INDEX_NONE;
+
+	// Unused, same name
+	void OnUnusedFilterChanged(ECheckBoxState NewState);
+	void OnSameNameFilterChanged(ECheckBoxState NewState);
+
+	// Age, size
+	void OnMinAgeCommitted(int32 NewMinAgeDays, ETextCommit::Type CommitType);
+	TOptional<int32> GetMinAgeDays() const { return MinAgeDays; }
+	void OnMinSizeCommitted(float NewMinSizeMegabytes, ETextCommit::Type CommitType);
+	TOptional<float> GetMinSizeMegabytes() const { return MinSizeMegabytes; }
+
+	int32 MinAgeDays = 0;
+	float MinSizeMegabytes = 0.f;
+
+	// Path
+	void OnPathFilterCommitted(const FText& NewPathWildcard, ETextCommit::Type CommitType);
+
+	/** Replace the rows of the listing condition and push them through every stage */
+	void SetSourceRows(TArray<FSuperManagerAssetRowId>&& NewSourceRows);
+
+	/** Re-run the stages changed since the last call, then rebuild the list */
+	void ApplyFilterPipeline();
+
+	/** ListedRows from SourceRows and the pipeline's last output, in source order */
+	void RebuildListedRows();
+
+	/** The size stage can only judge rows whose package size was read */
+	void GatherMissingSizes(const TArray<FSuperManagerAssetRowId>& Rows);
+
+	FSuperManagerFilterPipeline FilterPipeline;
+#pragma endregion
+
+
+#pragma region LiveUpdate
+
+	// Registry events are queued and applied to the table once per frame, never while a scan reads it
+	void RegisterLiveUpdates();
+	void UnregisterLiveUpdates();
+
+	void OnRegistryAssetAdded(const FAssetData& AssetData);
+	void OnRegistryAssetRemoved(const FAssetData& AssetData);
+	void OnRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnReferencersChanged(const TArray<FName>& ChangedPackages);
+
+	void RequestLiveUpdate();
+	EActiveTimerReturnType ApplyLiveUpdates(double InCurrentTime, float InDeltaTime);
+
+	bool IsUnderSelectedFolders(FName PackagePath) const;
+
+	/** Listing condition of one row, except same name and content duplicates which depend on the other rows */
+	bool PassesListingCondition(FSuperManagerAssetRowId Row) const;
+
+	/** Add or drop only these rows from the listed and displayed rows */
+	void ReevaluateRows(const TSet<int32>& AffectedRows);
+
+	TArray<FSoftObjectPath> PendingAddedAssets;
+	TArray<FSoftObjectPath> PendingRemovedAssets;
+	TSet<FName> PendingReferencerChanges;
+
+	TSharedPtr<FActiveTimerHandle> LiveUpdateTimerHandle;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle ReferencersChangedHandle;
+#pragma endregion
+
+
+#pragma region BackgroundScan
+
+	void StartBackgroundScan(const TSharedRef<class FSuperManagerAssetScan>& Scan);
+	void CancelBackgroundScan();
+	EActiveTimerReturnType TickBackgroundScan(double InCurrentTime, float InDeltaTime);
+
+	TSharedRef<SWidget> ConstructScanStatusBar();
+	FReply OnCancelScanButtonClicked();
+	TOptional<float> GetScanProgress() const;
+	FText GetScanStatusText() const;
+	EVisibility GetScanStatusVisibility() const;
+
+	TSharedPtr<class FSuperManagerAssetScan> ActiveScan;
+	TSharedPtr<FActiveTimerHandle> ScanTimerHandle;
+
+	// What the unreachable scan marked, kept to reevaluate rows after registry changes
+	TSharedPtr<const TBitArray<>> ReachableNodes;
+
+	// Copies are only known once every package is hashed, the first row of each package waits here until the scan ends
+	TArray<FSuperManagerAssetRowId> HashedRows;
+
+	/** List the copies among the rows of the packages in HashedRows */
+	void ListContentDuplicates();
+#pragma endregion
+
+
+#pragma region ReclaimableSize
+
+	// Sizes are kept in the table for the lifetime of the tab, a package is only read once
+	TArray<TSharedPtr<FSuperManagerFolderSize>> FolderSizes;
+	TSharedPtr<SListView<TSharedPtr<FSuperManagerFolderSize>>> FolderSizeListView;
+
+	TSharedRef<SWidget> ConstructFolderSizeView();
+	TSharedRef<ITableRow> OnGenerateRowForFolderSize(TSharedPtr<FSuperManagerFolderSize> FolderSize, const TSharedRef<STableViewBase>& OwnerTable);
+	void RefreshFolderSizes();
+
+	FString GetPackageSizeText(FSuperManagerAssetRowId Row) const;
+
+	TSharedRef<SButton> ConstructSortBySizeButton();
+	FReply OnSortBySizeButtonClicked();
+#pragma endregion
+
+
+#pragma region NameGroups
+
+	// Same name and content duplicate listings show their rows by group, a collapsed group only shows its first row
+	bool IsGroupingRows() const
+	{
+		return ListingCondition == EAdvanceDeletionListing::SameName || ListingCondition == EAdvanceDeletionListing::ContentDuplicates;
+	}
+
+	/** Put the rows of each name, or of each content hash, next to each other in ListedRows. Drops the groups when not grouping */
+	void BuildRowGroups();
+
+	int32 GetRowGroup(FSuperManagerAssetRowId Row) const;
+	bool IsGroupCollapsed(int32 GroupIndex) const;
+
+	/** First displayed row of a group of more than one row, it carries the group toggle */
+	bool IsGroupLeader(FSuperManagerAssetRowId Row) const;
+
+	TSharedRef<SWidget> ConstructGroupToggle(FSuperManagerAssetRowId RowToDisplay);
+	EVisibility GetGroupToggleVisibility(FSuperManagerAssetRowId Row) const;
+	const FSlateBrush* GetGroupToggleBrush(FSuperManagerAssetRowId Row) const;
+	FText GetGroupSizeText(FSuperManagerAssetRowId Row) const;
+	FReply OnGroupToggleClicked(FSuperManagerAssetRowId Row);
+
+	TArray<FSuperManagerRowGroup> RowGroups;
+
+	// Table row -> index in RowGroups, INDEX_NONE when not grouped
+	TArray<int32> GroupOfRow;
+
+	// Content duplicate listing only, one per group
+	TArray<FSuperManagerContentHash> GroupContentHashes;
+
+	// By name or by hash, a group stays collapsed when the rows are grouped again
+	TSet<FName> CollapsedGroupNames;
+	TSet<uint64> CollapsedContentHashes;
+#pragma endregion
+
+
+#pragma region SortableColumns
+
+	TSharedRef<SHeaderRow> ConstructHeaderRow();
+
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+	EColumnSortPriority::Type GetColumnSortPriority(FName ColumnId) const;
+	void OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+
+	/** Precomputed key of Row for ColumnId, compared as an integer */
+	int64 GetSortKey(const FName& ColumnId, FSuperManagerAssetRowId Row) const;
+
+	/** Order ListedRows by the primary then the secondary column */
+	void SortListedRows();
+
+	/** Sort again and refresh the displayed rows, checked rows stay checked */
+	void ResortListedRows();
+
+	/** Refresh the displayed rows from ListedRows as they are, checked rows stay checked */
+	void RedisplayListedRows();
+
+	FName PrimarySortColumn;
+	EColumnSortMode::Type PrimarySortMode = EColumnSortMode::None;
+
+	FName SecondarySortColumn;
+	EColumnSortMode::Type SecondarySortMode = EColumnSortMode::None;
+#pragma endregion
+
+
+#pragma region CheckState
+
+	// One bit per entry of DisplayedRows, rows that were never generated included
+	TBitArray<> CheckedRows;
+
+	// Table row -> index in DisplayedRows, INDEX_NONE when not displayed
+	TArray<int32> RowToDisplayedIndex;
+
+	// Anchor of a shift click range
+	int32 LastToggledRow = INDEX_NONE;
+
+	void ResetRowState();
+	void AppendRowState(int32 FirstNewRow);
+	int32 GetDisplayedIndex(FSuperManagerAssetRowId Row) const;
+	ECheckBoxState GetCheckBoxState(FSuperManagerAssetRowId Row) const;
+#pragma endregion
+
+
+#pragma region RowRemoval
+
+	/** Flag the rows whose asset is no longer in the registry. Returns how many were flagged */
+	int32 MarkDeletedRows(const TArray<FSuperManagerAssetRowId>& Rows);
+
+	/** One pass over each row list to drop flagged rows, then a list refresh without a rebuild */
+	void CompactDeletedRows();
+
+	/** Drop rows from the displayed rows in one pass, with their check bits */
+	void RemoveDisplayedRows(TFunctionRef<bool(FSuperManagerAssetRowId)> ShouldRemove);
+#pragma endregion
+
+
 #pragma region RowWidgetForAssetListView
 
-	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FAssetData> AssetDataToDisplay, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> OnGenerateRowForList(FSuperManagerAssetRowId RowToDisplay, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<SWidget> ConstructCellForColumn(const FName& ColumnId, FSuperManagerAssetRowId RowToDisplay);
 	
-	void OnRowWidgetMouseButtonClicked(TSharedPtr<FAssetData> ClickedData);
+	void OnRowWidgetMouseButtonClicked(FSuperManagerAssetRowId ClickedRow);
 
-	TSharedRef<SCheckBox> ConstructCheckBox(const TSharedPtr<FAssetData>& AssetDataToDisplay);
-	void OnCheckBoxStateChanged(ECheckBoxState NewState, TSharedPtr<FAssetData> AssetData);
+	TSharedRef<SCheckBox> ConstructCheckBox(FSuperManagerAssetRowId RowToDisplay);
+	void OnCheckBoxStateChanged(ECheckBoxState NewState, FSuperManagerAssetRowId Row);
 	TSharedRef<STextBlock> ConstructTextForRowWidget(const FString& TextContent, const FSlateFontInfo& FontToUse);
 
-	TSharedRef<SButton> ConstructButtonForRowWidget(const TSharedPtr<FAssetData>& AssetDataToDisplay);
-	FReply OnDeleteButtonClicked(TSharedPtr<FAssetData> ClickedAssetData);
+	// Bound instead of copied, live updates change the count of rows already on screen
+	FText GetReferencerCountText(FSuperManagerAssetRowId Row) const;
+
+	TSharedRef<SButton> ConstructButtonForRowWidget(FSuperManagerAssetRowId RowToDisplay);
+	FReply OnDeleteButtonClicked(FSuperManagerAssetRowId ClickedRow);
 #pragma endregion
 
 
@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "AssetIndex/SuperManagerReferenceIndex.h"
+#include "AssetIndex/SuperManagerPathExclusion.h"
+#include "AssetIndex/SuperManagerRedirectorFixup.h"
+#include "AssetIndex/SuperManagerAssetTable.h"
+#include "AssetIndex/SuperManagerContentHashes.h"
 
 class FSuperManagerModule : public IModuleInterface
 {
@@ -28,8 +33,7 @@ private:
 	void OnDeleteUnusedAssetButtonClicked();
 	void OnDeleteEmptyFoldersButtonClicked();
 	void OnAdvancedDeletionButtonClicked();
-
-	void FixUpRedirectors();
+	void OnAuditRedirectorsButtonClicked();
 
 #pragma endregion
 
@@ -37,7 +41,6 @@ private:
 
 	void RegisterAdvancedDeletionTab();
 	TSharedRef<SDockTab> OnSpawnAdvanceDeletionTab(const FSpawnTabArgs& SpawnTabArgs);
-	TArray<TSharedPtr<FAssetData>> GetAllAssetDataUnderSelectedFolder();
 #pragma endregion
 
 public:
@@ -47,13 +50,117 @@ public:
 	bool DeleteSingleAssetForAssetList(const FAssetData& AssetDataToDelete);
 	bool DeleteMutipleAssetsForAssetList(const TArray<FAssetData>& AssetsToDelete);
 
-	void ListUnusedAssetsForAssetList(
-		const TArray<TSharedPtr<FAssetData>>& AssetsDataToFilter, TArray<TSharedPtr<FAssetData>>& OutUnusedAssetsData);
+	void ListUnusedAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutUnusedRows);
+
+	void ListUnreachableAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutUnreachableRows);
+
+	/** Same filters as above, run on a worker thread. Matches stream back through the returned scan */
+	TSharedRef<class FSuperManagerAssetScan> StartUnusedAssetsScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, bool bGatherPackageSizes = false);
+
+	/**
+	 * The reachability pass runs on the worker too, into bits owned by this scan.
+	 * OutReachableNodes receives them, they may be read once the scan is complete
+	 */
+	TSharedRef<class FSuperManagerAssetScan> StartUnreachableAssetsScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, bool bGatherPackageSizes = false,
+		TSharedPtr<const TBitArray<>>* OutReachableNodes = nullptr);
+
+	void ListSameNameAssetsForAssetList(const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutSameNameRows);
+
+	/** Hash the package of every row on a worker thread, each package once. Matches are the first row of each package with a payload */
+	TSharedRef<class FSuperManagerAssetScan> StartContentHashScan(const TSharedRef<FSuperManagerAssetTable>& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToHash);
 
-	void ListSameNameAssetsForAssetList(
-		const TArray<TSharedPtr<FAssetData>>& AssetsDataToFilter, TArray<TSharedPtr<FAssetData>>& OutSameNameAssetsData);
+	/** Rows whose package is a copy of another one under a different name, from the hashes a content hash scan left in the cache */
+	void ListContentDuplicatesForAssetList(const FSuperManagerAssetTable& AssetTable,
+		const TArray<FSuperManagerAssetRowId>& RowsToFilter, TArray<FSuperManagerAssetRowId>& OutDuplicateRows);
 
 	void SyncCBToClickedAssetForAssetList(const FString& AssetPathToSync);
 
+#pragma endregion
+
+#pragma region SharedAnalysis
+
+	// Used by the content browser menu, the Advanced Deletion tab and the SuperManagerAudit commandlet. No dialogs in here
+
+	void FindUnusedAssets(const TArray<FAssetData>& AssetsData, TArray<FAssetData>& OutUnusedAssetsData);
+	void FindEmptyFolders(const TArray<FString>& FolderPaths, TArray<FString>& OutEmptyFolderPaths);
+
+	/**
+	 * On disk assets under FolderPaths and their sub folders that are not excluded, one registry query per folder.
+	 * Folders are gathered concurrently, a folder under another selected one is not gathered twice
+	 */
+	void GatherAssetsUnderFolders(const TArray<FString>& FolderPaths, TArray<FAssetData>& OutAssetsData);
+
+	/** Every asset under FolderPaths that is not excluded, with its referencer count and modified time */
+	TSharedRef<FSuperManagerAssetTable> BuildAssetTableUnderFolders(const TArray<FString>& FolderPaths);
+
+	/**
+	 * Packages proven unreferenced and not loaded are deleted from disk without loading them,
+	 * the rest go through ObjectTools::DeleteAssets, which keeps what is still referenced.
+	 * One confirmation covers both. Returns the number of assets deleted
+	 */
+	int32 DeleteAssetsWithoutLoading(const TArray<FAssetData>& AssetsToDelete, bool bShowConfirmation = true);
+
+#pragma endregion
+
+#pragma region PathExclusion
+
+	/** Compiled from USuperManagerSettings::ExcludedPathRules, recompiled when the rules change. Game thread */
+	const FSuperManagerPathExclusion& GetPathExclusion();
+
+private:
+	FSuperManagerPathExclusion PathExclusion;
+
+public:
+#pragma endregion
+
+#pragma region RedirectorFixup
+
+	/** Scoped redirector fixup shared by the content browser actions and UQuickAssetAction */
+	FSuperManagerRedirectorFixup& GetRedirectorFixup() { return RedirectorFixup; }
+
+private:
+	FSuperManagerRedirectorFixup RedirectorFixup;
+
+public:
+#pragma endregion
+
+#pragma region ContentHashes
+
+	/** Loaded from last session's file at startup, saved back on shutdown when packages were hashed */
+	FSuperManagerContentHashCache& GetContentHashCache() { return ContentHashCache; }
+
+private:
+	FSuperManagerContentHashCache ContentHashCache;
+
+public:
+#pragma endregion
+
+#pragma region ReferenceIndex
+
+	/** Built once, then kept current by AssetRegistry events. Only packages changed since the last call are re-linked */
+	FSuperManagerReferenceIndex& GetReferenceIndex();
+
+private:
+	FSuperManagerReferenceIndex ReferenceIndex;
+
+	void RegisterReferenceIndexDelegates();
+	void UnregisterReferenceIndexDelegates();
+
+	void OnRegistryFilesLoaded();
+	void OnRegistryAssetChanged(const FAssetData& AssetData);
+	void OnRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	FDelegateHandle FilesLoadedHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+
 #pragma endregion
 };
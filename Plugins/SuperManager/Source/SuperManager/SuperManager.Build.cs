@@ -27,7 +27,8 @@ public class SuperManager : ModuleRules
 			new string[]
 			{
 				"Core", "Blutility", "EditorScriptingUtilities", "UMG", "Niagara",
-				"UnrealEd", "AssetTools", "ContentBrowser", "InputCore", "Projects"
+				"UnrealEd", "AssetTools", "ContentBrowser", "InputCore", "Projects",
+				"DeveloperSettings"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -40,6 +41,10 @@ public class SuperManager : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"AssetRegistry",
+				"EngineSettings",
+				"DeveloperToolSettings",
+				"SourceControl",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);